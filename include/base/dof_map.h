@@ -32,6 +32,7 @@
 #include "libmesh/sparsity_pattern.h"
 #include "libmesh/parallel_object.h"
 #include "libmesh/point.h"
+#include "libmesh/simple_range.h"
 #include "libmesh/utility.h"
 
 // C++ Includes
@@ -40,6 +41,8 @@
 #include <iterator>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <memory>
 
@@ -102,6 +105,86 @@ class DofConstraints : public std::map<dof_id_type,
 {
 };
 
+/**
+ * A read-only copy of DofConstraints in compressed sparse row form:
+ * the constrained dofs in sorted order, and for each the dofs it is
+ * constrained in terms of and their coefficients, in contiguous
+ * arrays, along with a hash from constrained dof to row.
+ *
+ * DofMap builds one at the end of process_constraints(), once the
+ * constraints are fully expanded, so that constraint application
+ * during assembly needs no tree lookups.  DofMap discards it again
+ * whenever the constraints change.
+ */
+class FinalizedDofConstraints
+{
+public:
+  /**
+   * Replaces our contents with a copy of \p constraints.
+   */
+  void build (const DofConstraints & constraints);
+
+  void clear ();
+
+  /**
+   * \returns \p true if this has been built since the constraints
+   * last changed.
+   */
+  bool built () const { return _built; }
+
+  /**
+   * \returns The number of constrained dofs.
+   */
+  std::size_t n_rows () const { return _constrained_dofs.size(); }
+
+  /**
+   * \returns The row where \p dof is constrained, or \p invalid_row
+   * if it isn't.
+   */
+  std::size_t row (const dof_id_type dof) const
+  {
+    auto it = _row_of.find(dof);
+    return (it == _row_of.end()) ? invalid_row : it->second;
+  }
+
+  bool is_constrained (const dof_id_type dof) const
+  { return _row_of.count(dof); }
+
+  /**
+   * \returns The row of the first constrained dof no less than \p
+   * dof, or n_rows() if there is none.
+   */
+  std::size_t lower_bound (const dof_id_type dof) const
+  {
+    return std::distance(_constrained_dofs.begin(),
+                         std::lower_bound(_constrained_dofs.begin(),
+                                          _constrained_dofs.end(), dof));
+  }
+
+  dof_id_type constrained_dof (const std::size_t r) const
+  { return _constrained_dofs[r]; }
+
+  /**
+   * The entries of row \p r are at positions row_begin(r) through
+   * row_end(r)-1 of columns() and coefficients().
+   */
+  std::size_t row_begin (const std::size_t r) const { return _offsets[r]; }
+  std::size_t row_end (const std::size_t r) const { return _offsets[r+1]; }
+
+  const std::vector<dof_id_type> & columns () const { return _columns; }
+  const std::vector<Real> & coefficients () const { return _coefficients; }
+
+  static constexpr std::size_t invalid_row = static_cast<std::size_t>(-1);
+
+private:
+  bool _built = false;
+  std::vector<dof_id_type> _constrained_dofs;
+  std::vector<std::size_t> _offsets;
+  std::vector<dof_id_type> _columns;
+  std::vector<Real> _coefficients;
+  std::unordered_map<dof_id_type, std::size_t> _row_of;
+};
+
 /**
  * Storage for DofConstraint right hand sides for a particular
  * problem.  Each dof id with a non-zero constraint offset
@@ -259,6 +342,45 @@ public:
    */
   void set_constrained_sparsity_construction(bool use_constraints);
 
+  /**
+   * Sets whether compute_sparsity() may keep the sparsity pattern it
+   * computed previously, when nothing it was computed from has
+   * changed: the DoF distribution, the DoF indices on every active
+   * local element, and which DoFs each constraint row couples.  This
+   * makes System::reinit() cheap after an EquationSystems::reinit()
+   * that didn't actually change the mesh.
+   *
+   * This is false by default, because user-added coupling functors
+   * and extra sparsity functions may change couplings without
+   * changing any of the above.
+   */
+  void set_reuse_unchanged_sparsity(bool reuse);
+
+  /**
+   * Returns true iff compute_sparsity() may reuse an unchanged
+   * sparsity pattern.
+   */
+  bool reuse_unchanged_sparsity() const;
+
+  /**
+   * Sets the number of elements after which compute_sparsity() counts
+   * and frees the sparsity pattern rows it has built so far, when the
+   * matrices only need the numbers of nonzeros per row for
+   * preallocation.  This bounds the memory the pattern takes during
+   * the computation, at the cost of overestimating the counts of rows
+   * touched by elements in different batches.
+   *
+   * This is 0, i.e. all local elements in one batch, by default.  It
+   * has no effect when the full sparsity pattern is needed.
+   */
+  void set_streaming_sparsity_batch_size(std::size_t n_elem);
+
+  /**
+   * Returns the number of elements per batch when streaming sparsity
+   * pattern counts, or 0 if they are not streamed.
+   */
+  std::size_t streaming_sparsity_batch_size() const;
+
   /**
    * Sets need_full_sparsity_pattern to true regardless of the requirements by matrices
    */
@@ -836,6 +958,16 @@ public:
   bool local_index (dof_id_type dof_index) const
   { return (dof_index >= this->first_dof()) && (dof_index < this->end_dof()); }
 
+  /**
+   * Sorts the active local elements into \p interior, those whose
+   * degrees of freedom are all local and unconstrained, and \p
+   * boundary, the rest.  Work on \p interior elements needs no
+   * ghost values, so it can overlap a System::update_begin() /
+   * update_end() exchange.
+   */
+  void split_local_elements (std::vector<const Elem *> & interior,
+                             std::vector<const Elem *> & boundary) const;
+
   /**
    * \returns \p true iff our solutions can be locally evaluated on
    * \p obj (which should be an Elem or a Node) for variable number \p
@@ -859,6 +991,54 @@ public:
    */
   void set_verify_dirichlet_bc_consistency(bool val);
 
+  /**
+   * If \p val is \p true, distribute_dofs() numbers the dofs on each
+   * processor by visiting its active local elements in reverse
+   * Cuthill-McKee order of their side neighbor graph, rather than in
+   * mesh order.  This reduces the bandwidth of the local block of
+   * the system matrix, which helps ILU fill and matrix-vector cache
+   * reuse.  The dof counts on each processor are unchanged.
+   *
+   * This overrides the --bandwidth-reducing-dofs commandline option,
+   * and takes effect at the next distribute_dofs().
+   */
+  void set_bandwidth_reducing_dofs(bool val);
+
+  /**
+   * If \p val is \p true, distribute_dofs() also stores the dof
+   * indices of every active local element, by variable, so that
+   * later dof_indices() calls on those elements copy them instead of
+   * walking the element's nodes.  This trades memory, reported in
+   * get_info(), for assembly speed, particularly with many variables.
+   *
+   * The cache is discarded by reinit() and clear(), and rebuilt by
+   * the next distribute_dofs(); it must not be used across changes to
+   * element p levels that aren't followed by a distribute_dofs().
+   * Defaults to false unless --cache-dof-indices is on the command
+   * line.
+   */
+  void set_cache_dof_indices(bool val);
+
+  /**
+   * Returns true iff distribute_dofs() caches element dof indices.
+   */
+  bool cache_dof_indices() const { return _cache_dof_indices; }
+
+  /**
+   * If \p elem's dof indices are cached, \returns the position of
+   * each of them in the local storage of a GHOSTED vector built on
+   * the send list - owned dofs first, then the send list entries in
+   * order - and sets \p n_dofs to their number.  Otherwise \returns
+   * nullptr.
+   *
+   * These positions are computed by prepare_send_list(), so that an
+   * element's values can be gathered from a vector with
+   * NumericVector::get_local() without any global to local index
+   * translation.
+   */
+  const dof_id_type * ghosted_local_dof_indices (const Elem * elem,
+                                                 std::size_t & n_dofs) const;
+
   /**
    * Tells other library functions whether or not this problem
    * includes coupling between dofs in neighboring cells, as can
@@ -889,6 +1069,37 @@ public:
                               const MeshBase & mesh,
                               unsigned int var_num) const;
 
+  /**
+   * \returns The dof indices which live on the current processor for
+   * every variable, indexed by variable number, as \p
+   * local_variable_indices() would give them one variable at a time.
+   * All variables are gathered in a single pass over \p mesh, and the
+   * result is cached until the next reinit().
+   */
+  const std::vector<std::vector<dof_id_type>> &
+  all_local_variable_indices(const MeshBase & mesh) const;
+
+  /**
+   * \returns The dofs of variable \p var on the active local elements
+   * of subdomain \p subdomain_id, in increasing order and without
+   * repeats, including those owned by other processors on nodes and
+   * sides we share with them.  The lists for every subdomain and
+   * variable are gathered in a single pass over the mesh, the first
+   * time one is needed after each reinit(), and stored contiguously,
+   * so that the dofs on any set of subdomains can be formed by
+   * merging them.
+   */
+  SimpleRange<std::vector<dof_id_type>::const_iterator>
+  local_subdomain_dofs(subdomain_id_type subdomain_id,
+                       unsigned int var) const;
+
+  /**
+   * \returns The subdomains of the active local elements, in
+   * increasing order, i.e. those with a list in
+   * local_subdomain_dofs().
+   */
+  const std::vector<subdomain_id_type> & local_dof_subdomain_ids() const;
+
 #ifdef LIBMESH_ENABLE_CONSTRAINTS
 
   //--------------------------------------------------------------------
@@ -951,6 +1162,15 @@ public:
                            std::set<dof_id_type> & unexpanded_dofs,
                            bool look_for_constrainees);
 
+  /**
+   * Sends the constraint rows and right hand sides of the dofs in
+   * \p pushed_ids to each processor listed there, and adds any rows
+   * we are sent for dofs we don't already have constrained.  The dofs
+   * so added are inserted into \p added_dofs, if it is given.
+   */
+  void push_constraint_rows (const std::map<processor_id_type, std::set<dof_id_type>> & pushed_ids,
+                             std::set<dof_id_type> * added_dofs = nullptr);
+
   /**
    * Postprocesses any constrained degrees of freedom
    * to be constrained only in terms of unconstrained dofs, then adds
@@ -1030,16 +1250,26 @@ public:
    */
   const DofConstraints & get_dof_constraints() const { return _dof_constraints; }
 
+  /**
+   * \returns The compressed copy of the DofConstraints map built by
+   * process_constraints(), which is empty and not built() whenever
+   * the constraints have been changed since.
+   */
+  const FinalizedDofConstraints & get_finalized_dof_constraints() const
+  { return _finalized_dof_constraints; }
+
   void stash_dof_constraints()
   {
     libmesh_assert(_stashed_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    std::swap(_finalized_dof_constraints, _stashed_finalized_dof_constraints);
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    std::swap(_finalized_dof_constraints, _stashed_finalized_dof_constraints);
   }
 
   /**
@@ -1057,6 +1287,7 @@ public:
   void swap_dof_constraints()
   {
     _dof_constraints.swap(_stashed_dof_constraints);
+    std::swap(_finalized_dof_constraints, _stashed_finalized_dof_constraints);
   }
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -1615,6 +1846,13 @@ public:
    * which may be necessary in the case of spline control node
    * constraints or sufficiently many user constraints.
    */
+  /**
+   * \returns A hash of the local DoF distribution, the DoF indices on
+   * active local elements and the constraint couplings, for checking
+   * whether a sparsity pattern is still up to date.
+   */
+  dof_id_type sparsity_signature(const MeshBase & mesh) const;
+
   std::unique_ptr<SparsityPattern::Build> build_sparsity(const MeshBase & mesh,
                                                          bool calculate_constrained = false) const;
 
@@ -1763,6 +2001,34 @@ private:
    */
   void add_neighbors_to_send_list(MeshBase & mesh);
 
+  /**
+   * Fills the dof indices cache for the active local elements of \p
+   * mesh.
+   */
+  void build_dof_indices_cache(const MeshBase & mesh);
+
+  /**
+   * Empties the dof indices cache.
+   */
+  void clear_dof_indices_cache();
+
+  /**
+   * Fills the ghosted local positions of the cached dof indices,
+   * from the current send list.  If any cached dof is neither local
+   * nor on the send list, none are kept.
+   */
+  void build_ghosted_dof_indices_cache();
+
+  /**
+   * If \p elem is in the dof indices cache, fills \p di with its
+   * cached indices for variables \p v_begin up to \p v_end and
+   * \returns true; otherwise \returns false.
+   */
+  bool cached_dof_indices(const Elem * elem,
+                          std::vector<dof_id_type> & di,
+                          unsigned int v_begin,
+                          unsigned int v_end) const;
+
 #ifdef LIBMESH_ENABLE_CONSTRAINTS
 
   /**
@@ -1775,6 +2041,16 @@ private:
    * for an elements DOFs to be constrained by some other,
    * external DOFs.
    */
+  /**
+   * Calls \p f(dof_j, coef) for each entry of the constraint row of
+   * \p dof, reading the finalized constraints when they have been
+   * built.
+   *
+   * \returns \p true if \p dof is constrained.
+   */
+  template <typename Func>
+  bool for_each_constraint_entry (const dof_id_type dof, Func && f) const;
+
   void build_constraint_matrix (DenseMatrix<Number> & C,
                                 std::vector<dof_id_type> & elem_dofs,
                                 const bool called_recursively=false) const;
@@ -1841,6 +2117,24 @@ private:
    */
   bool _constrained_sparsity_construction;
 
+  /**
+   * This flag indicates whether compute_sparsity() may keep an
+   * existing sparsity pattern whose inputs haven't changed.
+   */
+  bool _reuse_unchanged_sparsity;
+
+  /**
+   * The number of elements per batch when streaming sparsity pattern
+   * counts, or 0 to keep every row until all are built.
+   */
+  std::size_t _streaming_sparsity_batch_size;
+
+  /**
+   * A hash of the inputs to the current sparsity pattern, when
+   * \p _reuse_unchanged_sparsity is set.
+   */
+  dof_id_type _sparsity_signature;
+
   /**
    * The finite element type for each variable.
    */
@@ -2037,6 +2331,13 @@ private:
    */
   DofConstraints _dof_constraints, _stashed_dof_constraints;
 
+  /**
+   * Compressed copies of \p _dof_constraints and \p
+   * _stashed_dof_constraints, once finalized.
+   */
+  FinalizedDofConstraints _finalized_dof_constraints,
+                          _stashed_finalized_dof_constraints;
+
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
@@ -2092,6 +2393,57 @@ private:
    * objects stored.
    */
   bool _verify_dirichlet_bc_consistency;
+
+  /**
+   * Flag which determines whether local dofs are numbered in reverse
+   * Cuthill-McKee order of the local elements.  Defaults to false
+   * unless --bandwidth-reducing-dofs is on the command line.
+   */
+  bool _bandwidth_reducing_dofs;
+
+  /**
+   * Flag which determines whether distribute_dofs() caches element
+   * dof indices.
+   */
+  bool _cache_dof_indices;
+
+  /**
+   * The dof indices cache, in compressed row form: each cached
+   * element maps to a row of \p _dof_indices_cache_offsets, holding
+   * the start of each variable's indices in \p _dof_indices_cache
+   * followed by the end of the last variable's.
+   */
+  std::unordered_map<const Elem *, std::size_t> _dof_indices_cache_rows;
+  std::vector<std::size_t> _dof_indices_cache_offsets;
+  std::vector<dof_id_type> _dof_indices_cache;
+
+  /**
+   * The positions of the \p _dof_indices_cache entries in ghosted
+   * local storage, or empty if they haven't been computed.
+   */
+  std::vector<dof_id_type> _dof_indices_cache_ghosted;
+
+  /**
+   * The cached result of all_local_variable_indices(), or empty if it
+   * hasn't been computed since the last reinit().
+   */
+  mutable std::vector<std::vector<dof_id_type>> _all_local_variable_indices;
+
+  /**
+   * Builds the lists behind local_subdomain_dofs() if they haven't
+   * been built since the last reinit().
+   */
+  void build_subdomain_dofs() const;
+
+  /**
+   * The lists of local_subdomain_dofs(), concatenated, with the list
+   * of variable \p v on subdomain \p _subdomain_dof_ids[s] starting at
+   * \p _subdomain_dof_offsets[s*n_variables()+v]; the offsets are
+   * empty if the lists have not been built since the last reinit().
+   */
+  mutable std::vector<subdomain_id_type> _subdomain_dof_ids;
+  mutable std::vector<std::size_t> _subdomain_dof_offsets;
+  mutable std::vector<dof_id_type> _subdomain_dofs;
 };
 
 
@@ -2186,6 +2538,9 @@ bool DofMap::is_constrained_node (const Node *
 inline
 bool DofMap::is_constrained_dof (const dof_id_type dof) const
 {
+  if (_finalized_dof_constraints.built())
+    return _finalized_dof_constraints.is_constrained(dof);
+
   if (_dof_constraints.count(dof))
     return true;
 
@@ -2193,6 +2548,35 @@ bool DofMap::is_constrained_dof (const dof_id_type dof) const
 }
 
 
+template <typename Func>
+inline
+bool DofMap::for_each_constraint_entry (const dof_id_type dof, Func && f) const
+{
+  if (_finalized_dof_constraints.built())
+    {
+      const FinalizedDofConstraints & finalized = _finalized_dof_constraints;
+      const std::size_t r = finalized.row(dof);
+      if (r == FinalizedDofConstraints::invalid_row)
+        return false;
+
+      const std::vector<dof_id_type> & columns = finalized.columns();
+      const std::vector<Real> & coefficients = finalized.coefficients();
+      for (std::size_t k = finalized.row_begin(r), end = finalized.row_end(r);
+           k != end; ++k)
+        f(columns[k], coefficients[k]);
+      return true;
+    }
+
+  const DofConstraints::const_iterator pos = _dof_constraints.find(dof);
+  if (pos == _dof_constraints.end())
+    return false;
+
+  for (const auto & [dof_j, coef] : pos->second)
+    f(dof_j, coef);
+  return true;
+}
+
+
 inline
 bool DofMap::has_heterogeneous_adjoint_constraints (const unsigned int qoi_num) const
 {
@@ -2311,6 +2695,30 @@ void DofMap::set_constrained_sparsity_construction(bool use_constraints)
   libmesh_ignore(use_constraints);
 }
 
+inline
+void DofMap::set_reuse_unchanged_sparsity(bool reuse)
+{
+  _reuse_unchanged_sparsity = reuse;
+}
+
+inline
+bool DofMap::reuse_unchanged_sparsity() const
+{
+  return _reuse_unchanged_sparsity;
+}
+
+inline
+void DofMap::set_streaming_sparsity_batch_size(std::size_t n_elem)
+{
+  _streaming_sparsity_batch_size = n_elem;
+}
+
+inline
+std::size_t DofMap::streaming_sparsity_batch_size() const
+{
+  return _streaming_sparsity_batch_size;
+}
+
 inline
 void DofMap::full_sparsity_pattern_needed()
 {
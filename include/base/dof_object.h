@@ -496,6 +496,13 @@ public:
    */
   unsigned int packed_indexing_size() const;
 
+  /**
+   * \returns The number of bytes allocated for the buffer holding our
+   * degree of freedom indices and extra integers.
+   */
+  std::size_t index_buffer_bytes() const
+  { return _idx_buf.capacity() * sizeof(index_t); }
+
   /**
    * If we have indices packed into an buffer for communications, how
    * much of that buffer applies to this dof object?
@@ -41,6 +41,7 @@
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 #include <cmath>
@@ -530,6 +531,12 @@ private:
    */
   std::vector<variable> variables;
 
+  /**
+   * index of each variable in 'variables', by its full name, so that
+   * lookups don't need a linear search
+   */
+  std::unordered_map<std::string, std::size_t> _variable_index;
+
   /**
    * comment delimiters
    */
@@ -771,6 +778,7 @@ GetPot::GetPot() :
   nominus_cursor(),
   idx_nominus(),
   variables(),
+  _variable_index(),
   _comment_start(),
   _comment_end(),
   _field_separator(),
@@ -802,6 +810,7 @@ GetPot::GetPot(const int argc_, const char * const * argv_,
   nominus_cursor(),
   idx_nominus(),
   variables(),
+  _variable_index(),
   _comment_start(),
   _comment_end(),
   _field_separator(),
@@ -863,6 +872,7 @@ GetPot::GetPot(const char* FileName,
   nominus_cursor(),
   idx_nominus(),
   variables(),
+  _variable_index(),
   _comment_start(),
   _comment_end(),
   _field_separator(),
@@ -898,6 +908,7 @@ GetPot::GetPot(const std::string& FileName,
   nominus_cursor(),
   idx_nominus(),
   variables(),
+  _variable_index(),
   _comment_start(),
   _comment_end(),
   _field_separator(),
@@ -943,6 +954,7 @@ GetPot::GetPot(std::istream& FileStream,
   nominus_cursor(),
   idx_nominus(),
   variables(),
+  _variable_index(),
   _comment_start(),
   _comment_end(),
   _field_separator(),
@@ -1005,6 +1017,7 @@ GetPot::GetPot(const GetPot& Other) :
   nominus_cursor(Other.nominus_cursor),
   idx_nominus(Other.idx_nominus),
   variables(Other.variables),
+  _variable_index(Other._variable_index),
   _comment_start(Other._comment_start),
   _comment_end(Other._comment_end),
   _field_separator(Other._field_separator),
@@ -1050,6 +1063,7 @@ GetPot::operator=(const GetPot& Other)
   overridden_vars      = Other.overridden_vars;
   idx_nominus          = Other.idx_nominus;
   variables            = Other.variables;
+  _variable_index      = Other._variable_index;
   _comment_start       = Other._comment_start;
   _comment_end         = Other._comment_end;
   _field_separator     = Other._field_separator;
@@ -1093,6 +1107,7 @@ GetPot::absorb(const GetPot& Other)
   //               search_loop_f
   argv      = Other.argv;
   variables = Other.variables;
+  _variable_index = Other._variable_index;
 
   if (request_recording_f)
     {
@@ -2475,8 +2490,10 @@ GetPot::_record_variable_request(const std::string& Name) const
   // Get a lock before touching anything mutable
   SCOPED_MUTEX;
 
-  // (*) record requested variable for later ufo detection
-  _requested_variables.insert(Name);
+  // (*) record requested variable for later ufo detection; if it was
+  //     already recorded then so were its sections
+  if (!_requested_variables.insert(Name).second)
+    return;
 
   // (*) record considered section for ufo detection
   STRING_VECTOR      STree = _get_section_tree(Name);
@@ -2498,7 +2515,10 @@ GetPot::_set_variable(const std::string& VarName,
     _request_variable(VarName.c_str()) :
     _find_variable(VarName.c_str());
   if (Var == 0)
-    variables.push_back(variable(VarName.c_str(), Value.c_str(), _field_separator.c_str()));
+    {
+      _variable_index.emplace(VarName, variables.size());
+      variables.push_back(variable(VarName.c_str(), Value.c_str(), _field_separator.c_str()));
+    }
   else
     {
       overridden_vars.insert(VarName.c_str());
@@ -2650,13 +2670,12 @@ GetPot::_find_variable(const char* VarName) const
 {
   const std::string Name = prefix + VarName;
 
-  std::vector<variable>::const_iterator it = variables.begin();
-  for (; it != variables.end(); ++it)
-    {
-      if ((*it).name == Name)
-        return &(*it);
-    }
-  return 0;
+  std::unordered_map<std::string, std::size_t>::const_iterator it =
+    _variable_index.find(Name);
+  if (it == _variable_index.end())
+    return 0;
+
+  return &variables[it->second];
 }
 
 
@@ -53,7 +53,7 @@ public:
 
   const PeriodicBoundaryBase * boundary(boundary_id_type id) const;
 
-  PeriodicBoundaries() = default;
+  PeriodicBoundaries();
 
   ~PeriodicBoundaries();
 
@@ -64,11 +64,25 @@ public:
   // used to output the side of the neighbor which corresponds to the
   // given \p side of \p e, or invalid_uint if no possible neighbor or
   // no corresponding side exists.
+  //
+  // The first call for each boundary id matches every active side on
+  // that boundary to the active side on the paired boundary with the
+  // same transformed vertices, all at once, and later calls look the
+  // result up.  The matches are recomputed after elements, node
+  // locations, or side boundary ids change.  Sides with no such match,
+  // e.g. where the refinement levels on either side differ, fall back
+  // to searching with \p point_locator.
   const Elem * neighbor(boundary_id_type boundary_id,
                         const PointLocatorBase & point_locator,
                         const Elem * e,
                         unsigned int side,
                         unsigned int * neigh_side = nullptr) const;
+
+private:
+  // The matched sides for each boundary id, defined in the .C file
+  struct NeighborTables;
+
+  std::unique_ptr<NeighborTables> _neighbor_tables;
 };
 
 } // namespace libMesh
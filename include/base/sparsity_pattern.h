@@ -26,7 +26,9 @@
 
 // C++ includes
 #include <algorithm> // is_sorted
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -51,7 +53,20 @@ namespace SparsityPattern // use a namespace so member classes can be forward-de
 typedef std::vector<dof_id_type, Threads::scalable_allocator<dof_id_type>> Row;
 class Graph : public std::vector<Row> {};
 
-class NonlocalGraph : public std::map<dof_id_type, Row> {};
+/**
+ * Rows belonging to other processors, hashed on global DoF number.
+ * These are only accumulated until they can be sent to their owners,
+ * so no ordering is needed.
+ */
+class NonlocalGraph : public std::unordered_map<dof_id_type, Row> {};
+
+/**
+ * Numbers of on- and off-processor nonzeros, relative to each row's
+ * owner, in rows belonging to other processors, hashed on global DoF
+ * number.  These take the place of a NonlocalGraph when a Build
+ * streams its counts.
+ */
+class NonlocalCounts : public std::unordered_map<dof_id_type, std::pair<dof_id_type, dof_id_type>> {};
 
 /**
  * Splices the two sorted ranges [begin,middle) and [middle,end)
@@ -98,6 +113,13 @@ static void sort_row (const BidirectionalIterator begin,
  * preallocation.  In this case it suffices to provide estimate
  * (but bounding) values, and in this case the threaded method can
  * take some short-cuts for efficiency.
+ *
+ * When only those estimates are needed, a nonzero \p
+ * streaming_batch_size makes the build count and discard the rows it
+ * has accumulated after every batch of that many elements, so that
+ * no more than one batch's worth of column indices is ever stored.
+ * Rows touched by elements in different batches are then overcounted,
+ * just as rows touched on different threads are.
  */
 class Build : public ParallelObject
 {
@@ -107,7 +129,8 @@ public:
          const std::set<GhostingFunctor *> & coupling_functors_in,
          const bool implicit_neighbor_dofs_in,
          const bool need_full_sparsity_pattern_in,
-         const bool calculate_constrained_in = false);
+         const bool calculate_constrained_in = false,
+         const std::size_t streaming_batch_size_in = 0);
 
   /**
    * Special functions.
@@ -210,6 +233,7 @@ private:
   const bool implicit_neighbor_dofs;
   const bool need_full_sparsity_pattern;
   const bool calculate_constrained;
+  const std::size_t streaming_batch_size;
 
   // If there are "spider" nodes in the mesh (i.e. a single node which
   // is connected to many 1D elements) and Constraints, we can end up
@@ -229,6 +253,19 @@ private:
                              std::vector<dof_id_type> & dofs_vi,
                              unsigned int vi);
 
+  /**
+   * Adds the rows accumulated so far to the nonzero counts, local and
+   * nonlocal, and frees them.  Only used when streaming.
+   */
+  void count_and_free_rows();
+
+  /**
+   * \returns \p true if we count rows as we go rather than keeping
+   * them until the end.
+   */
+  bool streaming() const
+  { return streaming_batch_size && !need_full_sparsity_pattern; }
+
 #ifndef LIBMESH_ENABLE_DEPRECATED
 private:
 #endif
@@ -237,6 +274,14 @@ private:
 
   SparsityPattern::NonlocalGraph nonlocal_pattern;
 
+  SparsityPattern::NonlocalCounts nonlocal_counts;
+
+  /**
+   * The local rows which have had entries added since they were
+   * last counted, when streaming.
+   */
+  std::vector<dof_id_type> uncounted_rows;
+
   std::vector<dof_id_type> n_nz;
 
   std::vector<dof_id_type> n_oz;
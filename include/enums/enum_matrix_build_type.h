@@ -29,7 +29,8 @@ namespace libMesh {
 enum class MatrixBuildType
 {
   AUTOMATIC,
-  DIAGONAL
+  DIAGONAL,
+  CSR
 };
 }
 
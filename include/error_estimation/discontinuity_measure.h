@@ -80,6 +80,8 @@ public:
 
   virtual ErrorEstimatorType type() const override;
 
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const override;
+
 protected:
 
   /**
@@ -65,6 +65,8 @@ public:
 
   virtual ErrorEstimatorType type() const override;
 
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const override;
+
 protected:
 
   /**
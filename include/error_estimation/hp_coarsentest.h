@@ -21,17 +21,8 @@
 #define LIBMESH_HP_COARSENTEST_H
 
 // Local Includes
-#include "libmesh/dense_matrix.h"
-#include "libmesh/dense_vector.h"
 #include "libmesh/hp_selector.h"
-#include "libmesh/id_types.h"
 #include "libmesh/libmesh_common.h"
-#include "libmesh/fe.h"         // MipsPro requires fe.h and quadrature.h
-#include "libmesh/quadrature.h" // Required for inline deletion std::unique_ptrs<> in destructor
-
-// C++ includes
-#include <vector>
-#include <memory>
 
 #ifdef LIBMESH_ENABLE_AMR
 
@@ -39,15 +30,7 @@ namespace libMesh
 {
 
 // Forward Declarations
-class Elem;
-class Point;
 class System;
-template <typename T> class TensorValue;
-template <typename T> class VectorValue;
-typedef VectorValue<Real> RealVectorValue;
-typedef TensorValue<Real> RealTensorValue;
-typedef RealVectorValue RealGradient;
-typedef RealTensorValue RealTensor;
 
 
 /**
@@ -77,16 +60,10 @@ public:
   }
 
   /**
-   * This class cannot be (default) copy constructed/assigned because
-   * it has unique_ptr members. Explicitly deleting these functions is
-   * the best way to document this fact.
-   */
-  HPCoarsenTest (const HPCoarsenTest &) = delete;
-  HPCoarsenTest & operator= (const HPCoarsenTest &) = delete;
-
-  /**
-   * Defaulted move ctor, move assignment operator, and destructor.
+   * Defaulted copy/move ctors, assignment operators, and destructor.
    */
+  HPCoarsenTest (const HPCoarsenTest &) = default;
+  HPCoarsenTest & operator= (const HPCoarsenTest &) = default;
   HPCoarsenTest (HPCoarsenTest &&) = default;
   HPCoarsenTest & operator= (HPCoarsenTest &&) = default;
   virtual ~HPCoarsenTest() = default;
@@ -116,62 +93,6 @@ public:
   { _extra_order = extraorder; }
 
 protected:
-  /**
-   * The helper function which adds individual fine element data to
-   * the coarse element projection
-   */
-  void add_projection(const System &, const Elem *, unsigned int var);
-
-  /**
-   * The coarse element on which a solution projection is cached
-   */
-  Elem * coarse;
-
-  /**
-   * Global DOF indices for fine elements
-   */
-  std::vector<dof_id_type> dof_indices;
-
-  /**
-   * The finite element objects for fine and coarse elements
-   */
-  std::unique_ptr<FEBase> fe, fe_coarse;
-
-  /**
-   * The shape functions and their derivatives
-   */
-  const std::vector<std::vector<Real>> * phi, * phi_coarse;
-  const std::vector<std::vector<RealGradient>> * dphi, * dphi_coarse;
-  const std::vector<std::vector<RealTensor>> * d2phi, * d2phi_coarse;
-
-  /**
-   * Mapping jacobians
-   */
-  const std::vector<Real> * JxW;
-
-  /**
-   * Quadrature locations
-   */
-  const std::vector<Point> * xyz_values;
-  std::vector<Point> coarse_qpoints;
-
-  /**
-   * The quadrature rule for the fine element
-   */
-  std::unique_ptr<QBase> qrule;
-
-  /**
-   * Linear system for projections
-   */
-  DenseMatrix<Number> Ke;
-  DenseVector<Number> Fe;
-  /**
-   * Coefficients for projected coarse and projected
-   * p-derefined solutions
-   */
-  DenseVector<Number> Uc;
-  DenseVector<Number> Up;
-
   /**
    * Extra order to use for quadrature rule
    */
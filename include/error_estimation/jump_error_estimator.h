@@ -88,6 +88,19 @@ public:
                                const NumericVector<Number> * solution_vector = nullptr,
                                bool estimate_parent_error = false) override;
 
+  /**
+   * \returns A new estimator with the same settings as this one, for
+   * use by another thread, or \p nullptr if the derived class doesn't
+   * support that.
+   *
+   * When libMesh is running with more than one thread and a clone is
+   * available, estimate_error() splits the active local elements
+   * between threads, each with its own estimator and contexts, and
+   * sums their contributions at the end.  Estimates which include
+   * parent elements are always computed serially.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const { return nullptr; }
+
   /**
    * This boolean flag allows you to scale the error indicator
    * result for each element by the number of "flux faces" the element
@@ -113,6 +126,31 @@ public:
   bool use_unweighted_quadrature_rules;
 
 protected:
+  /**
+   * Copies the settings of this estimator, but none of its
+   * integration state, to \p other.  Derived classes implementing
+   * clone() should call this and then copy their own settings.
+   */
+  void copy_settings_to (JumpErrorEstimator & other) const;
+
+  /**
+   * Creates the fine and coarse contexts for \p system and requests
+   * the FE data the side integrations need.
+   */
+  void init_contexts (const System & system);
+
+  /**
+   * Adds the jump contributions from each side of the active element
+   * \p e which it is responsible for, and from its parent if \p
+   * estimate_parent_error and that hasn't been done yet, to \p
+   * error_per_cell and (if we scale by them) \p n_flux_faces.
+   */
+  void estimate_element_error (const System & system,
+                               const Elem * e,
+                               std::vector<ErrorVectorReal> & error_per_cell,
+                               std::vector<float> & n_flux_faces,
+                               bool estimate_parent_error);
+
   /**
    * A utility function to reinit the finite element data on elements sharing a
    * side
@@ -166,6 +204,13 @@ protected:
    * The variable number currently being evaluated
    */
   unsigned int var;
+
+private:
+
+  /**
+   * The body of the threaded element loop in estimate_error().
+   */
+  class EstimateErrorThread;
 };
 
 
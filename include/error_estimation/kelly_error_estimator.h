@@ -90,6 +90,8 @@ public:
 
   virtual ErrorEstimatorType type() const override;
 
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const override;
+
 protected:
 
   /**
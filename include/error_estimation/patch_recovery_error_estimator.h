@@ -35,6 +35,7 @@ namespace libMesh
 
 // Forward Declarations
 class Elem;
+class MeshBase;
 enum Order : int;
 
 /**
@@ -92,6 +93,26 @@ public:
 
   void set_patch_reuse (bool);
 
+  /**
+   * Enables or disables keeping the patches built by estimate_error()
+   * for later calls on the same mesh, e.g. when estimating several
+   * systems or variables, or primal and adjoint solutions, in turn.
+   * Patches for every active local element are then built up front,
+   * in parallel, and stored in compressed rows.
+   *
+   * The cache is rebuilt when the mesh, its element counts, the
+   * target patch size or the growth strategy change, but a mesh
+   * modified in place without changing those can't be detected; call
+   * clear_patch_cache() after such changes.  Caching is disabled by
+   * default.
+   */
+  void set_patch_caching (bool);
+
+  /**
+   * Discards any cached patches.
+   */
+  void clear_patch_cache ();
+
   /**
    * Increases or decreases the order of the quadrature rule used for numerical
    * integration.  The default \p extraorder is 1, because properly
@@ -114,6 +135,16 @@ protected:
                                     const Point p,
                                     const unsigned int matsize);
 
+  /**
+   * Computes the spectral polynomial basis function values at a point
+   * (x,y,z) into \p psi, reusing its storage.
+   */
+  static void specpoly(const unsigned int dim,
+                       const Order order,
+                       const Point p,
+                       const unsigned int matsize,
+                       std::vector<Real> & psi);
+
   bool patch_reuse;
 
   /**
@@ -123,6 +154,36 @@ protected:
 
 private:
 
+  /**
+   * Builds the patch around every active local element of \p mesh
+   * into the patch cache, unless the cache is already up to date.
+   */
+  void update_patch_cache (const MeshBase & mesh);
+
+  /**
+   * Whether to cache patches between calls to estimate_error().
+   */
+  bool _cache_patches;
+
+  /**
+   * The patch around each active local element \p e is
+   * \p _patch_elems[_patch_offsets[e->id()]] through
+   * \p _patch_elems[_patch_offsets[e->id()+1]-1], in the same order a
+   * Patch would iterate over it.  Rows of other elements are empty.
+   */
+  std::vector<std::size_t> _patch_offsets;
+  std::vector<const Elem *> _patch_elems;
+
+  /**
+   * What the cached patches were built for, so we can tell when
+   * they're out of date.
+   */
+  const MeshBase * _patch_cache_mesh;
+  dof_id_type _patch_cache_max_elem_id;
+  dof_id_type _patch_cache_n_active_elem;
+  unsigned int _patch_cache_size;
+  Patch::PMF _patch_cache_strategy;
+
   /**
    * Class to compute the error contribution for a range
    * of elements. May be executed in parallel on separate threads.
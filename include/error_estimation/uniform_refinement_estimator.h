@@ -130,6 +130,19 @@ public:
    */
   unsigned char number_p_refinements;
 
+  /**
+   * How many batches to refine the mesh in.  With the default of 1
+   * the whole mesh is refined and solved on at once.  With more,
+   * each processor splits its active local elements into that many
+   * contiguous chunks, and each batch refines one chunk per processor
+   * (plus a buffer of neighboring elements), solves, and measures the
+   * error on the chunk before coarsening again.  The refined mesh
+   * then only grows by a fraction of the full refinement, at the
+   * cost of one solve per batch, and the estimate in each chunk only
+   * sees refinement nearby.
+   */
+  unsigned int n_refinement_batches;
+
 protected:
 
   /**
@@ -148,6 +161,16 @@ protected:
                                 const std::map<const System *, SystemNorm > * error_norms,
                                 const std::map<const System *, const NumericVector<Number> *> * solution_vectors = nullptr,
                                 bool estimate_parent_error = false);
+
+  /**
+   * Solves the refined \p system_list, or all of \p es if \p
+   * equation_systems is given, for the forward or adjoint solutions
+   * picked out by \p solution_vectors.
+   */
+  void _solve_refined_systems (EquationSystems & es,
+                               const EquationSystems * equation_systems,
+                               const std::vector<System *> & system_list,
+                               const std::map<const System *, const NumericVector<Number> *> * solution_vectors);
 };
 
 } // namespace libMesh
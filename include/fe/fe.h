@@ -27,6 +27,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <memory>
 
 namespace libMesh
 {
@@ -745,6 +746,36 @@ protected:
                                       std::vector<Number> & nodal_soln_on_side,
                                       bool add_p_level = true);
 
+  /**
+   * Shape function values and reference derivatives at a set of
+   * reference points.  For families whose shapes don't need reinit,
+   * these depend only on the element type, the total approximation
+   * order and the points, so one copy can be shared by every FE
+   * object in the process.
+   */
+  struct ReferenceValues
+  {
+    std::vector<Point> points;
+    std::vector<std::vector<OutputShape>> phi;
+    std::vector<std::vector<OutputShape>> dphidxi, dphideta, dphidzeta;
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    bool has_d2phi = false;
+    std::vector<std::vector<OutputShape>> d2phidxi2, d2phidxideta, d2phideta2,
+      d2phidxidzeta, d2phidetadzeta, d2phidzeta2;
+#endif
+  };
+
+  /**
+   * \returns Reference values for \p elem at the points of the
+   * attached quadrature rule, from a process-wide cache keyed on
+   * the element type, total order and quadrature rule.  Values are
+   * computed and inserted into the cache on a miss.
+   *
+   * Only valid for families where \p shapes_need_reinit() is false.
+   */
+  std::shared_ptr<const ReferenceValues>
+  get_reference_values (const Elem * elem) const;
+
   /**
    * An array of the node locations on the last
    * element we computed on
@@ -1528,6 +1559,27 @@ void lagrange_nodal_soln(const Elem * elem,
  */
 unsigned int monomial_n_dofs(const ElemType t, const Order o);
 
+#ifdef LIBMESH_ENABLE_HIGHER_ORDER_SHAPES
+/**
+ * Helper functions for Bernstein basis functions.
+ */
+// values[k] is the degree \p order Bernstein polynomial with power k
+// of (1+xi)/2, and (*derivs)[k] its derivative with respect to xi,
+// all evaluated together by de Casteljau's recursion
+void bernstein_1D_shapes(const unsigned int order,
+                         const Real xi,
+                         std::vector<Real> & values,
+                         std::vector<Real> * derivs = nullptr);
+
+// The power of (1+xi)/2 in the 1D Bernstein shape function i
+inline
+unsigned int bernstein_1D_power(const unsigned int i,
+                                const unsigned int order)
+{
+  return (i == 0) ? 0 : ((i == 1) ? order : i - 1);
+}
+#endif // LIBMESH_ENABLE_HIGHER_ORDER_SHAPES
+
 /**
  * Helper functions for rational basis functions.
  */
@@ -53,9 +53,11 @@ class BoundaryInfo;
 class DofConstraints;
 class DofMap;
 class Elem;
+class ElemSideBuilder;
 class MeshBase;
 template <typename T> class NumericVector;
 class QBase;
+class TensorProductKernel;
 enum ElemType : int;
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -498,6 +500,15 @@ public:
    */
   FEType get_fe_type()  const { return fe_type; }
 
+  /**
+   * \returns A sum-factorized interpolation and integration kernel
+   * for this finite element type on elements of type \p type with the
+   * attached quadrature rule, or \p nullptr if
+   * TensorProductKernel::supports() rejects them, in which case the
+   * usual shape function arrays should be used instead.
+   */
+  std::unique_ptr<TensorProductKernel> build_tensor_product_kernel (const ElemType type) const;
+
   /**
    * \returns The approximation order of the finite element.
    */
@@ -630,8 +641,21 @@ protected:
    */
   virtual void compute_shape_functions(const Elem *, const std::vector<Point> & ) =0;
 
+  /**
+   * \returns Side \p s of \p elem, built in storage which is reused
+   * by every side reinit on this object, so that those need not
+   * allocate a new side element each time.  The side is only valid
+   * until the next call.
+   */
+  const Elem & reusable_side (const Elem & elem, const unsigned int s);
+
   std::unique_ptr<FEMap> _fe_map;
 
+  /**
+   * The storage behind reusable_side(), built on first use.
+   */
+  std::unique_ptr<ElemSideBuilder> _side_builder;
+
 
   /**
    * The dimensionality of the object
@@ -513,6 +513,53 @@ public:
 
 #endif
 
+  /**
+   * Contiguous storage for the shape function values, gradients and
+   * JxW of a batch of elements, filled by \p reinit_batch().
+   *
+   * Data is stored "structure of arrays" style with the element index
+   * varying fastest, so that a loop over the elements of a batch at
+   * a fixed shape function and quadrature point is unit-stride:
+   *
+   * JxW[qp*n_elem + e]
+   * phi[(i*n_qp + qp)*n_elem + e]
+   * dphidx[(i*n_qp + qp)*n_elem + e], and likewise dphidy, dphidz
+   */
+  struct BatchValues
+  {
+    unsigned int n_elem = 0;
+    unsigned int n_qp = 0;
+    unsigned int n_shapes = 0;
+
+    std::vector<Real> JxW;
+    std::vector<OutputShape> phi;
+    std::vector<OutputShape> dphidx;
+    std::vector<OutputShape> dphidy;
+    std::vector<OutputShape> dphidz;
+
+    std::size_t index (unsigned int i, unsigned int qp, unsigned int e) const
+    { return (std::size_t(i)*n_qp + qp)*n_elem + e; }
+  };
+
+  /**
+   * Computes JxW, and whichever of phi and dphi have been requested,
+   * on each of the elements in \p elems, using the current
+   * quadrature rule, and stores the results in \p values.
+   *
+   * The elements should all share one type and p refinement level.
+   * For scalar-valued families whose reference values do not depend
+   * on the element, with a Lagrange map and no second derivatives
+   * requested, the mapping Jacobians and physical gradients for the
+   * whole batch are computed in loops over the element index, which
+   * compilers can vectorize.  All other cases fall back on calling
+   * \p reinit() once per element.
+   *
+   * Afterwards the FE object's own data describes just one of the
+   * batch elements; call \p reinit() before using it directly again.
+   */
+  void reinit_batch (const std::vector<const Elem *> & elems,
+                     BatchValues & values);
+
   /**
    * Prints the value of each shape function at each quadrature point.
    */
@@ -614,6 +661,13 @@ protected:
   std::vector<std::vector<OutputShape>>   phi;
   std::vector<std::vector<OutputShape>>   dual_phi;
 
+  /**
+   * Set by derived classes when \p phi already holds the (element
+   * independent) shape function values at the current points, so
+   * compute_shape_functions() needn't map them again.
+   */
+  bool phi_is_reference;
+
   /**
    * Shape function derivative values.
    */
@@ -830,6 +884,7 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
   _fe_trans( FETransformationBase<OutputType>::build(fet) ),
   phi(),
   dual_phi(),
+  phi_is_reference(false),
   dphi(),
   dual_dphi(),
   curl_phi(),
@@ -773,7 +773,9 @@ public:
   /**
    * Computes the constraint matrix contributions (for
    * non-conforming adapted meshes) corresponding to
-   * variable number \p var_number.
+   * variable number \p var_number.  Dofs already in \p constraints
+   * are left alone; \p constraints must not be shared between
+   * threads.
    */
   static void compute_constraints (DofConstraints & constraints,
                                    DofMap & dof_map,
@@ -785,7 +787,9 @@ public:
   /**
    * Computes the constraint matrix contributions (for
    * periodic boundary conditions) corresponding to
-   * variable number \p var_number.
+   * variable number \p var_number.  Dofs already in \p constraints
+   * are left alone; \p constraints must not be shared between
+   * threads.
    */
   static void compute_periodic_constraints (DofConstraints & constraints,
                                             DofMap & dof_map,
@@ -640,6 +640,12 @@ public:
    */
   void set_jacobian_tolerance(Real tol) { jacobian_tolerance = tol; }
 
+  /**
+   * \returns The Jacobian tolerance used for determining when the
+   * mapping fails.
+   */
+  Real get_jacobian_tolerance() const { return jacobian_tolerance; }
+
 protected:
 
   /**
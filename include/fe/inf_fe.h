@@ -1220,6 +1220,30 @@ protected:
    */
   FEType current_fe_type;
 
+  /**
+   * Whether \p base_fe holds the base shape functions at the points
+   * of its quadrature rule, and the base p level they were computed
+   * for.  These only depend on the type of the base element, so
+   * \p reinit() reuses them across infinite elements.
+   */
+  bool base_shapes_on_qrule;
+
+  unsigned int base_shapes_p_level;
+
+  /**
+   * The derivatives of the Lagrange shape functions of non-affine
+   * base elements at the points \p base_lagrange_qp, for the base
+   * element type \p base_lagrange_type, reused across infinite
+   * elements by \p compute_shape_functions().
+   */
+  std::vector<std::vector<Real>> base_lagrange_dxi;
+
+  std::vector<std::vector<Real>> base_lagrange_deta;
+
+  ElemType base_lagrange_type;
+
+  std::vector<Point> base_lagrange_qp;
+
 
 private:
 
@@ -0,0 +1,177 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+
+#ifndef LIBMESH_SIDE_QUADRATURE_CACHE_H
+#define LIBMESH_SIDE_QUADRATURE_CACHE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/enum_quadrature_type.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <cstddef>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class MeshBase;
+
+/**
+ * The \p SideQuadratureCache class computes, once, the side
+ * quadrature data which boundary integrals on a fixed mesh would
+ * otherwise recompute every time they are assembled: the JxW values,
+ * physical quadrature points, unit normals and shape function values
+ * of one scalar FE type on every active local element side with one
+ * of a chosen set of boundary ids.  The data lives in flat arrays,
+ * one block per side.
+ *
+ * The cache goes out of date whenever the mesh's geometry_version()
+ * changes, i.e. when elements are added or removed or
+ * MeshBase::nodes_moved() is called; \p update() then rebuilds it.
+ * An FEMContext given the cache with FEMContext::set_side_cache()
+ * skips reinitializing its side FE objects on cached sides, and
+ * offers the cached data through FEMContext::get_cached_side()
+ * instead.
+ *
+ * \date 2024
+ */
+class SideQuadratureCache
+{
+public:
+  /**
+   * Constructor.  The cache holds data for shape functions of type \p
+   * fe_type, on side quadrature rules of type \p qtype and order \p
+   * qorder; to match an FEMContext's side rule, pass its
+   * get_side_qrule().type() and get_order().
+   */
+  SideQuadratureCache (const MeshBase & mesh,
+                       const FEType & fe_type,
+                       QuadratureType qtype,
+                       Order qorder);
+
+  /**
+   * The cached data on a single side.  Per quadrature point values
+   * are indexed by \p qp, and shape function values by
+   * phi[i*n_qp + qp].
+   */
+  struct SideData
+  {
+    unsigned int n_qp;
+    unsigned int n_shapes;
+    const Real * JxW;
+    const Point * xyz;
+    const Point * normals;
+    const Real * phi;
+  };
+
+  /**
+   * Adds sides with boundary id \p id to those cached, as of the next
+   * \p update().
+   */
+  void add_boundary_id (boundary_id_type id);
+
+  /**
+   * \returns The boundary ids whose sides are cached.
+   */
+  const std::set<boundary_id_type> & get_boundary_ids () const
+  { return _boundary_ids; }
+
+  /**
+   * Rebuilds the cache if it is not current.  Not thread safe; call
+   * this before a threaded assembly, not during one.
+   */
+  void update ();
+
+  /**
+   * \returns \p true if the cache has been built for the current mesh
+   * geometry and boundary ids.
+   */
+  bool is_current () const;
+
+  /**
+   * Empties the cache.
+   */
+  void clear ();
+
+  /**
+   * \returns The cached data for side \p s of \p elem, or \p nullptr
+   * if that side is not cached.
+   */
+  const SideData * side_data (const Elem & elem,
+                              unsigned int s) const;
+
+  /**
+   * \returns The number of cached sides.
+   */
+  std::size_t n_sides () const { return _sides.size(); }
+
+private:
+  const MeshBase & _mesh;
+
+  const FEType _fe_type;
+
+  const QuadratureType _qtype;
+
+  const Order _qorder;
+
+  std::set<boundary_id_type> _boundary_ids;
+
+  /**
+   * Whether the arrays are built, and the mesh version and boundary
+   * ids they were built for.
+   */
+  bool _built;
+
+  std::size_t _geometry_version;
+
+  std::set<boundary_id_type> _built_boundary_ids;
+
+  /**
+   * The index into \p _sides of each cached (element id, side).
+   */
+  std::map<std::pair<dof_id_type, unsigned int>, std::size_t> _side_index;
+
+  /**
+   * Per-side data, pointing into the flat arrays below.
+   */
+  std::vector<SideData> _sides;
+
+  std::vector<Real> _JxW;
+
+  std::vector<Point> _xyz;
+
+  std::vector<Point> _normals;
+
+  std::vector<Real> _phi;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SIDE_QUADRATURE_CACHE_H
@@ -0,0 +1,216 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TENSOR_PRODUCT_KERNEL_H
+#define LIBMESH_TENSOR_PRODUCT_KERNEL_H
+
+// Local includes
+#include "libmesh/fe_type.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <map>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class FEAbstract;
+class QBase;
+enum ElemType : int;
+
+/**
+ * Sum-factorized evaluation of tensor-product finite element spaces
+ * on quadrilaterals and hexahedra.
+ *
+ * For LAGRANGE, L2_LAGRANGE, HIERARCHIC and L2_HIERARCHIC bases on
+ * QUAD and HEX elements with a QGauss rule, every shape function is a
+ * (possibly rescaled) product of one dimensional basis functions, and
+ * the quadrature points are a tensor product of one dimensional Gauss
+ * points.  Interpolating a field to all quadrature points, or
+ * integrating against all test functions, can then be done one
+ * direction at a time, in O(p^{d+1}) work rather than the O(p^{2d})
+ * of looping over the phi and dphi arrays an FE object computes.
+ *
+ * The kernels work from the one dimensional tables alone, so an FE
+ * object used alongside them only needs to compute its map; request
+ * get_JxW() from it, not get_phi() or get_dphi().
+ *
+ * Which tensor product each element degree of freedom is depends on
+ * the element orientation for hierarchic bases.  That is worked out
+ * from the shape functions themselves on the first element of each
+ * vertex ordering and cached, so reinit() is cheap thereafter.
+ *
+ * Like an FE object, a kernel holds scratch space, so each thread
+ * should use its own.
+ *
+ * \date 2024
+ * \brief Sum-factorized interpolation and integration on tensor elements.
+ */
+class TensorProductKernel
+{
+public:
+  /**
+   * Constructor.  Sets up the one dimensional tables for \p fe_type
+   * on elements of type \p type with the quadrature rule \p qrule,
+   * which must be one supports() accepts.
+   */
+  TensorProductKernel (const FEType & fe_type,
+                       const ElemType type,
+                       const QBase & qrule);
+
+  /**
+   * \returns \p true if \p fe_type on elements of type \p type
+   * integrated with \p qrule can be evaluated by sum factorization.
+   */
+  static bool supports (const FEType & fe_type,
+                        const ElemType type,
+                        const QBase & qrule);
+
+  /**
+   * Prepares to work on \p elem, which must have the type given to
+   * the constructor and no p refinement.
+   */
+  void reinit (const Elem & elem);
+
+  /**
+   * \returns The number of element degrees of freedom.
+   */
+  unsigned int n_dofs () const { return _n_dofs; }
+
+  /**
+   * \returns The number of quadrature points.
+   */
+  unsigned int n_qp () const { return _n_qp; }
+
+  /**
+   * Computes the values at each quadrature point of the field with
+   * element coefficients \p coefs.
+   */
+  void interpolate (const std::vector<Number> & coefs,
+                    std::vector<Number> & values) const;
+
+  /**
+   * Computes the physical gradients at each quadrature point of the
+   * field with element coefficients \p coefs.  \p fe must have been
+   * reinit() on the same element with the same quadrature rule.
+   */
+  void interpolate_gradients (const std::vector<Number> & coefs,
+                              const FEAbstract & fe,
+                              std::vector<Gradient> & gradients) const;
+
+  /**
+   * Adds \f$ \sum_q \phi_i(x_q) f_q \f$ to \p residual(i) for each
+   * degree of freedom \p i.  Any JxW weighting is up to the caller,
+   * to be included in \p qp_values.
+   */
+  void integrate (const std::vector<Number> & qp_values,
+                  std::vector<Number> & residual) const;
+
+  /**
+   * Adds \f$ \sum_q \nabla \phi_i(x_q) \cdot g_q \f$ to \p
+   * residual(i) for each degree of freedom \p i.  \p fe must have
+   * been reinit() on the same element with the same quadrature rule.
+   * Any JxW weighting is up to the caller, to be included in \p
+   * qp_gradients.
+   */
+  void integrate_gradients (const std::vector<Gradient> & qp_gradients,
+                            const FEAbstract & fe,
+                            std::vector<Number> & residual) const;
+
+private:
+
+  /**
+   * Where each element degree of freedom lives in the tensor
+   * product basis.
+   */
+  struct DofLayout
+  {
+    // The tensor index a0 + n1*(a1 + n1*a2) of each dof
+    std::vector<unsigned int> tensor_index;
+
+    // The factor relating each dof's shape function to its tensor
+    // product of one dimensional functions
+    std::vector<Real> scale;
+  };
+
+  /**
+   * Works out the DofLayout on \p elem from its shape functions.
+   */
+  DofLayout find_layout (const Elem & elem) const;
+
+  /**
+   * Applies the matrices \p M[d] along each direction \p d in turn,
+   * taking the \p n_in^dim tensor \p in to the \p n_out^dim tensor
+   * \p out.  \p M[d] is stored row-major, \p n_out by \p n_in.
+   */
+  void apply (const std::vector<const Real *> & M,
+              unsigned int n_in,
+              unsigned int n_out,
+              const std::vector<Number> & in,
+              std::vector<Number> & out) const;
+
+  /**
+   * Gathers \p coefs into the tensor ordering, or scatters and adds
+   * \p _tensor back into \p residual, with each dof's scale.
+   */
+  void gather (const std::vector<Number> & coefs) const;
+  void scatter_add (std::vector<Number> & residual) const;
+
+  FEType _fe_type;
+
+  ElemType _type;
+
+  unsigned int _dim;
+
+  /**
+   * The number of one dimensional basis functions and one
+   * dimensional quadrature points.
+   */
+  unsigned int _n1, _nq1;
+
+  unsigned int _n_dofs, _n_qp;
+
+  /**
+   * The one dimensional basis values and derivatives at the one
+   * dimensional quadrature points, stored row-major as \p _nq1 by \p
+   * _n1 matrices, and their transposes.
+   */
+  std::vector<Real> _B, _D, _Bt, _Dt;
+
+  /**
+   * The dof layouts we've found so far, keyed by the ranking of
+   * each element vertex in point order, which is all that hierarchic
+   * orientations depend on.
+   */
+  std::map<std::vector<unsigned int>, DofLayout> _layouts;
+
+  const DofLayout * _layout;
+
+  /**
+   * Scratch space.
+   */
+  mutable std::vector<Number> _tensor, _work1, _work2;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_TENSOR_PRODUCT_KERNEL_H
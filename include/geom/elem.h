@@ -1017,9 +1017,11 @@ public:
    * For linear elements, performs an initial tight bounding box check
    * (as an optimization step) and (if that passes) then uses the
    * user-defined tolerance "tol" in a call to inverse_map() to actually
-   * test if the point is in the element.  For quadratic elements, the
-   * bounding box optimization is skipped, and only the inverse_map()
-   * steps are performed.
+   * test if the point is in the element.  Linear hexes, prisms and
+   * pyramids test the point against their side planes first, and only
+   * need inverse_map() for points near a side or when a side is not
+   * planar.  For quadratic elements, the bounding box optimization is
+   * skipped, and only the inverse_map() steps are performed.
    *
    * \note This routine should not be used to determine if a point
    * is merely "nearby" an element to within some tolerance. For that,
@@ -2081,6 +2083,14 @@ public:
 
 protected:
 
+  // Besides the DofObject data and the node and neighbor link arrays
+  // every subclass embeds, an Elem stores only the pointers below,
+  // and its subdomain id, refinement flags, p level and mapping data
+  // together fill a single word.  The rarely used refinement tree
+  // costs one pointer per element, the children array being
+  // allocated only for parents, and an interior parent slot is only
+  // reserved by elements of lower dimension than LIBMESH_DIM.
+
   /**
    * Pointers to the nodes we are connected to.
    */
@@ -2626,6 +2636,7 @@ Elem::simple_build_side_ptr (std::unique_ptr<Elem> & side,
     }
   else
     {
+      side->set_interior_parent(this);
       side->subdomain_id() = this->subdomain_id();
       side->set_mapping_type(this->mapping_type());
 #ifdef LIBMESH_ENABLE_AMR
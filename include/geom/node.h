@@ -26,6 +26,7 @@
 #include "libmesh/reference_counted_object.h"
 
 // C++ includes
+#include <cstddef>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -131,6 +132,25 @@ public:
                                       const Real z,
                                       const dof_id_type id);
 
+  /**
+   * Nodes are allocated from a process-wide pool of fixed-size
+   * blocks rather than individually from the heap, which makes
+   * building and destroying large meshes much cheaper.  Memory from
+   * deleted Nodes is kept for reuse by new Nodes until
+   * \p release_memory() is called.
+   */
+  static void * operator new (std::size_t size);
+  static void operator delete (void * p, std::size_t size) noexcept;
+
+  /**
+   * Returns the memory held by the Node pool to the heap, if no
+   * pool-allocated Node is still alive.  The mesh classes call this
+   * after deleting their Nodes in \p clear().
+   *
+   * \returns \p true if any memory was released.
+   */
+  static bool release_memory ();
+
   /**
    * \returns \p true if the node is active.  An active node is
    * defined as one for which \p id() is not \p Node::invalid_id.
@@ -115,6 +115,18 @@ public:
   {
   }
 
+  /**
+   * Constructor.  Takes a read-only std::vector of objects, such as
+   * the vectors cached by MeshBase::active_local_element_vector().
+   * As above, the vector MUST outlive this StoredRange, and
+   * reset(first, last), which would overwrite it, may not be called.
+   */
+  StoredRange (const vec_type * objs,
+               const unsigned int new_grainsize = 1000) :
+    StoredRange(const_cast<vec_type *>(objs), new_grainsize)
+  {
+  }
+
   /**
    * Copy constructor.  The \p StoredRange can be copied into
    * subranges for parallel execution.  In this way the
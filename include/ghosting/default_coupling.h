@@ -84,12 +84,12 @@ public:
 
   // Change number of levels of neighbors to couple.
   void set_n_levels(unsigned int n_levels)
-  { _n_levels = n_levels; }
+  { _n_levels = n_levels; this->clear_cache(); }
 
 #ifdef LIBMESH_ENABLE_PERIODIC
   // Set PeriodicBoundaries to couple
   void set_periodic_boundaries(const PeriodicBoundaries * periodic_bcs) override
-  { _periodic_bcs = periodic_bcs; }
+  { _periodic_bcs = periodic_bcs; this->clear_cache(); }
 #endif
 
   /**
@@ -98,6 +98,12 @@ public:
    */
   virtual void mesh_reinit () override;
 
+  /**
+   * Our results can be cached, except across periodic boundaries,
+   * which may be added to without our knowledge.
+   */
+  virtual bool cacheable () const override;
+
   virtual void redistribute () override
   { this->mesh_reinit(); }
 
@@ -79,7 +79,7 @@ public:
 #ifdef LIBMESH_ENABLE_PERIODIC
   // Set PeriodicBoundaries to couple
   void set_periodic_boundaries(const PeriodicBoundaries * periodic_bcs) override
-  { _periodic_bcs = periodic_bcs; }
+  { _periodic_bcs = periodic_bcs; this->clear_cache(); }
 #endif
 
   /**
@@ -88,6 +88,12 @@ public:
    */
   virtual void mesh_reinit () override;
 
+  /**
+   * Our results can be cached, except across periodic boundaries,
+   * which may be added to without our knowledge.
+   */
+  virtual bool cacheable () const override;
+
   virtual void redistribute () override
   { this->mesh_reinit(); }
 
@@ -29,6 +29,7 @@
 
 // C++ Includes
 #include <unordered_map>
+#include <vector>
 
 namespace libMesh
 {
@@ -290,8 +291,54 @@ public:
    */
   virtual void delete_remote_elements () {};
 
+  /**
+   * Subclasses whose results depend only on the elements of the mesh
+   * and their connectivity (not on solution values, subdomain ids,
+   * or processor ids other than to omit elements on processor \p p)
+   * and on their own settings, and whose results for a range of
+   * elements are just the union of their results for each element,
+   * may return true here.
+   *
+   * Geometric ghosting queries will then cache the elements returned
+   * for each element queried, and reuse them until elements are
+   * added to, removed from, or renumbered in the mesh.  This saves
+   * redoing neighbor searches in every redistribution of an
+   * unchanged mesh.  Such subclasses must call clear_cache() whenever
+   * a change to their settings might change their results.
+   */
+  virtual bool cacheable () const { return false; }
+
+  /**
+   * Adds to \p ghosted_elements each element that operator() would
+   * return for the same range and processor id \p p, ignoring
+   * coupling matrices.  If this functor is cacheable(), results for
+   * each element in the range are cached and reused while the \p
+   * mesh elements are unchanged.
+   */
+  void ghosted_elements (const MeshBase & mesh,
+                         const MeshBase::const_element_iterator & range_begin,
+                         const MeshBase::const_element_iterator & range_end,
+                         processor_id_type p,
+                         std::vector<const Elem *> & ghosted_elements);
+
+  /**
+   * Discards any results cached by ghosted_elements().
+   */
+  void clear_cache ();
+
 protected:
   const MeshBase * _mesh;
+
+private:
+
+  /**
+   * The elements returned for each element queried by
+   * ghosted_elements(), with no processor's elements omitted, and the
+   * mesh and MeshBase::elems_version() they were found with.
+   */
+  std::unordered_map<const Elem *, std::vector<const Elem *>> _cached_elements;
+  const MeshBase * _cached_mesh = nullptr;
+  std::size_t _cached_elems_version = 0;
 };
 
 } // namespace libMesh
@@ -25,6 +25,8 @@
 
 // C++ Includes
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace libMesh
 {
@@ -85,22 +87,38 @@ public:
 
   // Change number of levels of point neighbors to couple.
   void set_n_levels(unsigned int n_levels)
-  { _n_levels = n_levels; }
+  { _n_levels = n_levels; this->clear_cache(); }
 
 #ifdef LIBMESH_ENABLE_PERIODIC
   // Set PeriodicBoundaries to couple.
   //
   // FIXME: This capability is not currently implemented.
   void set_periodic_boundaries(const PeriodicBoundaries * periodic_bcs) override
-  { _periodic_bcs = periodic_bcs; }
+  { _periodic_bcs = periodic_bcs; this->clear_cache(); }
 #endif
 
   /**
    * If we have periodic boundaries, then we'll need the mesh to have
    * an updated point locator whenever we're about to query them.
+   *
+   * Otherwise, if we're coupling point neighbors, we rebuild our
+   * node to element adjacency for the changed mesh.
    */
   virtual void mesh_reinit () override;
 
+  /**
+   * We make sure our node to element adjacency is up to date before
+   * any send_list or sparsity pattern queries.
+   */
+  virtual void dofmap_reinit () override
+  { this->mesh_reinit(); }
+
+  /**
+   * Our results can be cached, except across periodic boundaries,
+   * which may be added to without our knowledge.
+   */
+  virtual bool cacheable () const override;
+
   virtual void redistribute () override
   { this->mesh_reinit(); }
 
@@ -113,6 +131,13 @@ public:
    *
    * This will include the point neighbors, point neighbors of point
    * neighbors, etc, to n_levels depth.
+   *
+   * On a conforming mesh, point neighbors are found from a node to
+   * element adjacency built by mesh_reinit(), with each level's
+   * elements split over threads.  This also finds elements which
+   * share a node without being connected through side neighbors,
+   * e.g. across a slit.  Otherwise, or before mesh_reinit() has
+   * seen the current mesh, Elem::find_point_neighbors() is used.
    */
   virtual void operator() (const MeshBase::const_element_iterator & range_begin,
                            const MeshBase::const_element_iterator & range_end,
@@ -121,11 +146,48 @@ public:
 
 private:
 
+  /**
+   * Rebuilds the node to element adjacency, if it isn't already up to
+   * date for the current mesh.
+   */
+  void build_node_elems ();
+
+  /**
+   * \returns \p true if the node to element adjacency is up to date
+   * for the current mesh and can be used to find point neighbors.
+   */
+  bool use_node_elems () const;
+
+  /**
+   * Adds to \p neighbors the elements in the same manifold as \p elem
+   * which share one of its nodes, including \p elem itself.
+   */
+  void node_neighbors (const Elem & elem,
+                       std::vector<const Elem *> & neighbors) const;
+
   const CouplingMatrix * _dof_coupling;
 #ifdef LIBMESH_ENABLE_PERIODIC
   const PeriodicBoundaries * _periodic_bcs;
 #endif
   unsigned int _n_levels;
+
+  /**
+   * The active elements touching each node, in compressed rows: the
+   * elements touching the node with id \p i are entries
+   * \p _node_elem_offsets[r] through \p _node_elem_offsets[r+1]-1
+   * of \p _node_elems, where \p r is \p _node_rows[i].
+   */
+  std::unordered_map<dof_id_type, std::size_t> _node_rows;
+  std::vector<std::size_t> _node_elem_offsets;
+  std::vector<const Elem *> _node_elems;
+
+  /**
+   * The mesh and MeshBase::elems_version() the adjacency was built
+   * for, if it was built; it isn't on nonconforming meshes, where
+   * point neighbors needn't share a node.
+   */
+  const MeshBase * _node_elems_mesh = nullptr;
+  std::size_t _node_elems_version = 0;
 };
 
 } // namespace libMesh
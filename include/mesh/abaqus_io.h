@@ -31,6 +31,9 @@
 namespace libMesh
 {
 
+// Forward declarations
+class TextTokenizer;
+
 /**
  * The AbaqusIO class is a preliminary implementation for reading
  * Abaqus mesh files in ASCII format.
@@ -202,9 +205,9 @@ private:
   sideset_container_t _sideset_ids;
 
   /**
-   * Stream object used to interact with the file
+   * Tokenizer over the contents of the file
    */
-  std::unique_ptr<std::istream> _in;
+  std::unique_ptr<TextTokenizer> _in;
 
   /**
    * A set of the different geometric element types detected when reading the
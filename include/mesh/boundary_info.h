@@ -27,6 +27,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <set>
 #include <vector>
@@ -305,6 +306,14 @@ public:
    */
   void remove (const Elem * elem);
 
+  /**
+   * Removes the boundary conditions associated with every element in
+   * \p elems, if any exist.  This is equivalent to calling remove()
+   * on each element, but cheaper when removing many elements at once,
+   * e.g. when coarsening.
+   */
+  void remove (std::vector<const Elem *> elems);
+
   /**
    * Removes boundary id \p id from node \p node, if it exists.
    */
@@ -499,6 +508,13 @@ public:
   unsigned int n_raw_boundary_ids (const Elem * const elem,
                                    const unsigned short int side) const;
 
+  /**
+   * \returns \p true if any side of element \p elem has a raw
+   * (excludes ancestors) boundary id.  This is one lookup, rather than
+   * one per side.
+   */
+  bool has_raw_side_boundary_ids (const Elem * const elem) const;
+
   /**
    * \returns The list of boundary ids associated with the \p side side of
    * element \p elem.
@@ -687,6 +703,18 @@ public:
   enum class BCTupleSortBy {ELEM_ID, SIDE_ID, BOUNDARY_ID, UNSORTED};
   std::vector<BCTuple> build_side_list(BCTupleSortBy sort_by = BCTupleSortBy::ELEM_ID) const;
 
+  /**
+   * Adds every (elem-id, side-id, bc-id) triplet in \p sides, in the
+   * format returned by build_side_list(), to the boundary information
+   * data structure.  Duplicate entries are ignored.
+   *
+   * This is much faster than repeated add_side() calls when adding
+   * many sides at once, e.g. when reading a mesh: the triplets are
+   * sorted first, so that each one is inserted next to its
+   * predecessor rather than searched for.
+   */
+  void add_sides (const std::vector<BCTuple> & sides);
+
   /**
    * Creates a list of active element numbers, sides, and ids for those sides.
    *
@@ -911,6 +939,20 @@ public:
   const std::multimap<const Elem *, std::pair<unsigned short int, boundary_id_type>> & get_sideset_map() const
   { return _boundary_side_id; }
 
+  /**
+   * \returns A number which changes whenever side boundary ids are
+   * added, removed, or renumbered, so that data derived from the
+   * sideset map can tell when it has gone out of date.
+   */
+  std::size_t sideset_version () const
+  { return _sideset_version; }
+
+  /**
+   * \returns An estimate of the number of bytes used by the boundary
+   * id maps on this processor, and by the side index built from them.
+   */
+  std::size_t memory_usage () const;
+
   /**
    * \returns Whether or not there may be child elements directly assigned boundary sides
    */
@@ -933,10 +975,33 @@ private:
    */
   void libmesh_assert_valid_multimaps() const;
 
+  /**
+   * Rebuilds the side index from \p _boundary_side_id.
+   */
+  void build_side_index();
+
+  /**
+   * Records a change to \p _boundary_side_id.
+   */
+  void sideset_changed ()
+  { _side_index_valid = false; ++_sideset_version; }
+
+  /**
+   * Calls \p f with each raw boundary id on side \p side of \p elem,
+   * using the side index when it is up to date.
+   */
+  template <typename Func>
+  void for_each_raw_side_id (const Elem * elem,
+                             unsigned short int side,
+                             Func f) const;
+
   /**
    * Helper method for finding consistent maps of interior to boundary
    * dof_object ids.  Either node_id_map or side_id_map can be nullptr,
-   * in which case it will not be filled.
+   * in which case it will not be filled.  The boundary ids are derived
+   * from the interior element ids and side numbers, and node ids, so
+   * each processor finds those of every object it holds without
+   * communication.
    */
   void _find_id_maps (const std::set<boundary_id_type> & requested_boundary_ids,
                       dof_id_type first_free_node_id,
@@ -981,6 +1046,36 @@ private:
                 std::pair<unsigned short int, boundary_id_type>>
   _boundary_side_id;
 
+  /**
+   * A flat, read-only copy of \p _boundary_side_id, rebuilt by
+   * regenerate_id_sets() and used for lookups until the next change
+   * to the sideset map.  Binary searching the contiguous, sorted
+   * \p _side_index_elems touches far less memory than walking the
+   * multimap.
+   *
+   * The entries for \p _side_index_elems[i] are
+   * \p _side_index_values[_side_index_offsets[i]] up to
+   * \p _side_index_values[_side_index_offsets[i+1]], in multimap
+   * order.  Bit \p s of \p _side_index_masks[i] is set if side \p s
+   * has any entry (sides past 63 share the last bit), so that the
+   * common query for a side with no ids doesn't look at the values
+   * at all.
+   */
+  std::vector<const Elem *> _side_index_elems;
+  std::vector<std::uint64_t> _side_index_masks;
+  std::vector<std::size_t> _side_index_offsets;
+  std::vector<std::pair<unsigned short int, boundary_id_type>> _side_index_values;
+
+  /**
+   * Whether the side index matches \p _boundary_side_id.
+   */
+  bool _side_index_valid;
+
+  /**
+   * Incremented by every change to \p _boundary_side_id.
+   */
+  std::size_t _sideset_version;
+
   /*
    * Whether or not children elements are associated with any boundary
    * It is false by default. The flag will be turned on if `add_side`
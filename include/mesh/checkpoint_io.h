@@ -325,6 +325,18 @@ private:
 
   processor_id_type select_split_config(const std::string & input_name, header_id_type & data_size);
 
+  /**
+   * \returns The processor which takes ownership of objects that
+   * belonged to processor \p pid when the file being read was
+   * written.  When restarting from a split for more processors than
+   * we are using, each processor takes a contiguous range of the
+   * split's pieces, so pieces which were neighbors (as they are for
+   * space-filling-curve and graph partitioners) stay together and the
+   * result is usable without repartitioning.  Otherwise ids "wrap
+   * around" our processor count.
+   */
+  processor_id_type restart_processor_id(largest_id_type pid) const;
+
   bool _binary;
   bool _parallel;
   std::string _version;
@@ -334,6 +346,10 @@ private:
 
   // The largest processor id to write
   processor_id_type _my_n_processors;
+
+  // The number of processors the split being read was written for,
+  // or 0 for a serial file
+  processor_id_type _input_n_procs;
 };
 
 
@@ -0,0 +1,143 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_COMPACT_MESH_VIEW_H
+#define LIBMESH_COMPACT_MESH_VIEW_H
+
+// Local includes
+#include "libmesh/bounding_box.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <unordered_map>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * A read-only, structure-of-arrays copy of the geometry and
+ * connectivity of a mesh.  Node coordinates are stored in contiguous
+ * x, y and z arrays, and active element connectivity is stored as
+ * flat arrays of local node indices, one block per element type.
+ * Loops over these arrays stream through memory instead of chasing
+ * Elem and Node pointers across the heap.
+ *
+ * This is a snapshot: it is not updated when the mesh changes, and
+ * it must be rebuilt after any modification of the mesh nodes or
+ * elements.  On a distributed mesh only the nodes and elements held
+ * by this processor are included.
+ *
+ * \date 2024
+ * \brief Flat copy of mesh coordinates and connectivity.
+ */
+class CompactMeshView
+{
+public:
+  /**
+   * The active elements of a single type.  The local node indices of
+   * element \p e are connectivity[e*n_nodes] through
+   * connectivity[(e+1)*n_nodes - 1].
+   */
+  struct ElemBlock
+  {
+    ElemType type;
+    unsigned int n_nodes;
+    std::vector<dof_id_type> elem_ids;
+    std::vector<dof_id_type> connectivity;
+  };
+
+  /**
+   * Copies the coordinates of every node and the connectivity of
+   * every active element in \p mesh.
+   */
+  explicit CompactMeshView (const MeshBase & mesh);
+
+  /**
+   * \returns The number of nodes in the view.
+   */
+  std::size_t n_nodes() const { return _node_ids.size(); }
+
+  /**
+   * \returns The x, y and z coordinates of the nodes, indexed by
+   * local node index.
+   */
+  const std::vector<Real> & x() const { return _x; }
+  const std::vector<Real> & y() const { return _y; }
+  const std::vector<Real> & z() const { return _z; }
+
+  /**
+   * \returns The location of the node with local index \p i.
+   */
+  Point point (std::size_t i) const;
+
+  /**
+   * \returns The mesh id of the node with local index \p i.
+   */
+  dof_id_type node_id (std::size_t i) const { return _node_ids[i]; }
+
+  /**
+   * \returns The local index of the node with mesh id \p id.
+   */
+  dof_id_type local_index (dof_id_type id) const;
+
+  /**
+   * \returns The active element blocks, one per element type present.
+   */
+  const std::vector<ElemBlock> & elem_blocks() const { return _blocks; }
+
+  /**
+   * \returns The bounding box of every node in the view.
+   */
+  BoundingBox bounding_box () const;
+
+  /**
+   * Fills \p centroids with the average of the nodes of each element
+   * in \p block, in block order.
+   */
+  void vertex_averages (const ElemBlock & block,
+                        std::vector<Point> & centroids) const;
+
+private:
+  std::vector<Real> _x, _y, _z;
+
+  std::vector<dof_id_type> _node_ids;
+
+  std::unordered_map<dof_id_type, dof_id_type> _local_index;
+
+  std::vector<ElemBlock> _blocks;
+};
+
+
+
+// ------------------------------------------------------------
+// CompactMeshView inline methods
+inline
+Point CompactMeshView::point (std::size_t i) const
+{
+  return Point(_x[i], _y[i], _z[i]);
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_COMPACT_MESH_VIEW_H
@@ -23,7 +23,9 @@
 // Local Includes
 #include "libmesh_config.h"
 
-#if LIBMESH_MAPVECTOR_CHUNK_SIZE == 1
+#if defined(LIBMESH_ENABLE_PAGED_MAPVECTOR)
+#  include "libmesh/paged_mapvector.h"
+#elif LIBMESH_MAPVECTOR_CHUNK_SIZE == 1
 #  include "libmesh/mapvector.h"
 #else
 #  include "libmesh/chunked_mapvector.h"
@@ -59,7 +61,9 @@ class DistributedMesh : public UnstructuredMesh
 public:
 
   template <typename Obj>
-#if LIBMESH_MAPVECTOR_CHUNK_SIZE == 1
+#if defined(LIBMESH_ENABLE_PAGED_MAPVECTOR)
+  using dofobject_container = paged_mapvector<Obj *, dof_id_type>;
+#elif LIBMESH_MAPVECTOR_CHUNK_SIZE == 1
   using dofobject_container = mapvector<Obj *, dof_id_type>;
 #else
   using dofobject_container = chunked_mapvector<Obj *, dof_id_type, LIBMESH_MAPVECTOR_CHUNK_SIZE>;
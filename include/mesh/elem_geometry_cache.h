@@ -0,0 +1,144 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_ELEM_GEOMETRY_CACHE_H
+#define LIBMESH_ELEM_GEOMETRY_CACHE_H
+
+// Local includes
+#include "libmesh/bounding_box.h"
+#include "libmesh/elem.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * Stores the volume, hmin(), hmax(), vertex_average() and
+ * loose_bounding_box() of every element of a mesh, in flat arrays
+ * indexed by element id.  Code which asks for these repeatedly, such
+ * as error estimators and contact searches, can look them up here
+ * instead of recomputing them, some through quadrature, on each call.
+ *
+ * The values are computed on construction and by build(), in a
+ * threaded pass over every element held by this processor.  The cache
+ * is current until MeshBase::geometry_version() changes: adding,
+ * removing or renumbering elements, as refinement and coarsening do,
+ * changes it, as do the MeshTools::Modification functions and the
+ * mesh smoothers.  Code which moves nodes directly should call
+ * MeshBase::nodes_moved() afterward.  Call update() to rebuild a
+ * stale cache; the accessors assert that it is current.
+ *
+ * \date 2024
+ * \brief Per-mesh cache of element geometric quantities.
+ */
+class ElemGeometryCache
+{
+public:
+  /**
+   * Computes the cached values for every element of \p mesh.
+   */
+  explicit ElemGeometryCache (const MeshBase & mesh);
+
+  /**
+   * Recomputes the cached values for every element of the mesh.
+   */
+  void build ();
+
+  /**
+   * Calls build() if the cache is not current.
+   */
+  void update ();
+
+  /**
+   * \returns \p true if the mesh geometry has not changed since the
+   * cache was last built.
+   */
+  bool is_current () const;
+
+  /**
+   * \returns The cached value of \p elem.volume(), \p elem.hmin(),
+   * \p elem.hmax(), \p elem.vertex_average() or
+   * \p elem.loose_bounding_box().
+   */
+  Real volume (const Elem & elem) const
+  { return _volume[this->index(elem)]; }
+
+  Real hmin (const Elem & elem) const
+  { return _hmin[this->index(elem)]; }
+
+  Real hmax (const Elem & elem) const
+  { return _hmax[this->index(elem)]; }
+
+  const Point & vertex_average (const Elem & elem) const
+  { return _vertex_average[this->index(elem)]; }
+
+  const BoundingBox & loose_bounding_box (const Elem & elem) const
+  { return _bounding_box[this->index(elem)]; }
+
+private:
+
+  /**
+   * \returns The array index of \p elem, after checking in debug
+   * mode that the cache is current and holds \p elem.
+   */
+  dof_id_type index (const Elem & elem) const;
+
+  const MeshBase & _mesh;
+
+  /**
+   * The MeshBase::geometry_version() the cache was built at.
+   */
+  std::size_t _geometry_version;
+
+  std::vector<Real> _volume, _hmin, _hmax;
+
+  std::vector<Point> _vertex_average;
+
+  std::vector<BoundingBox> _bounding_box;
+
+  /**
+   * Whether each element id was held by this processor, and so has
+   * cached values.
+   */
+  std::vector<unsigned char> _cached;
+};
+
+
+
+// ------------------------------------------------------------
+// ElemGeometryCache inline methods
+inline
+dof_id_type ElemGeometryCache::index (const Elem & elem) const
+{
+  libmesh_assert(this->is_current());
+  const dof_id_type id = elem.id();
+  libmesh_assert_less(id, _cached.size());
+  libmesh_assert(_cached[id]);
+  return id;
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_GEOMETRY_CACHE_H
@@ -29,11 +29,16 @@
 #include "libmesh/boundary_info.h" // BoundaryInfo::BCTuple
 #include "libmesh/exodus_header_info.h"
 
+// C++ includes
+#include <memory>
+
 namespace libMesh
 {
 
 // Forward declarations
+class Elem;
 class EquationSystems;
+class ExodusAsyncWriter;
 class ExodusII_IO_Helper;
 class MeshBase;
 class System;
@@ -92,6 +97,25 @@ public:
    */
   virtual void read (const std::string & name) override;
 
+  /**
+   * Reads the mesh in the ExodusII file named \p name on every
+   * processor at once, without ever holding the whole mesh on any
+   * one of them.  Each processor reads a contiguous range of the
+   * file's elements, and the coordinates of only the nodes those
+   * elements use, and the elements are assigned to the processor
+   * which read them.  Neighboring elements are then exchanged, so a
+   * DistributedMesh is left with its local elements plus ghosts,
+   * while a ReplicatedMesh is gathered onto every processor.
+   *
+   * Call \p MeshBase::prepare_for_use() afterward, as after any
+   * read; pass \p skip_partitioning to keep the file-order partition.
+   *
+   * This function must be called on all processors at once.  Extra
+   * integer variables, element sets, edge blocks, and Bezier
+   * extraction data are not yet supported.
+   */
+  void read_distributed (const std::string & name);
+
   /**
    * Read only the header information, instead of the entire
    * mesh. After the header is read, the file is closed and the
@@ -267,6 +291,17 @@ public:
    const std::set<std::string> * system_names = nullptr,
    const std::string & var_suffix = "_elem_node_");
 
+  /**
+   * Writes the mesh, if it hasn't been written yet, and the nodal
+   * solution of \p es.  Once the mesh is in the file, subsequent
+   * calls on a distributed mesh only gather the solution values to
+   * processor 0, rather than serializing the whole mesh onto it each
+   * time.
+   */
+  virtual void write_equation_systems (const std::string & fname,
+                                       const EquationSystems & es,
+                                       const std::set<std::string> * system_names=nullptr) override;
+
   /**
    * Bring in base class functionality for name resolution and to
    * avoid warnings about hidden overloaded virtual functions.
@@ -521,6 +556,31 @@ public:
    */
   void append(bool val);
 
+  /**
+   * Set to true (false is the default) to write nodal data, global
+   * data and timestep values asynchronously.  The values are still
+   * gathered to processor 0 and copied into staging buffers before
+   * write_timestep(), write_nodal_data() or write_global_data()
+   * returns, so the caller is free to change its solution vectors,
+   * but the Exodus calls which write them to the file are made from
+   * a background thread on processor 0.  Without C++11 thread
+   * support the writes are made immediately, as usual.
+   *
+   * Any other use of this object (reading, writing the mesh or
+   * element data, or closing the file) waits for the pending
+   * writes first.
+   */
+  void set_async_output(bool async);
+
+  /**
+   * Blocks until all writes queued in asynchronous output mode have
+   * been written to the file.  Call this at checkpoint boundaries,
+   * or before anything else (e.g. another process) reads the file.
+   * Errors which occurred while writing in the background are
+   * reported here.
+   */
+  void wait();
+
   /**
    * Return list of the elemental variable names
    */
@@ -572,6 +632,15 @@ public:
    */
   void set_hdf5_writing(bool write_hdf5);
 
+  /**
+   * Sets the deflate compression \p level, from 0 (the default, no
+   * compression) to 9, and whether the shuffle filter is used, for
+   * files written afterwards.  Levels 1 or 2 usually give most of
+   * the size reduction at a small cost in write time.  This only has
+   * an effect when writing HDF5-based files, see set_hdf5_writing().
+   */
+  void set_compression(int level, bool shuffle = true);
+
   /**
    * Set to true (false is the default) to generate independent nodes
    * for every Bezier Extraction element in an input file containing
@@ -616,6 +685,20 @@ private:
    * rather than created from scratch when writing.
    */
   bool _append;
+
+  /**
+   * The background writer used in asynchronous output mode, or
+   * nullptr if writes are synchronous.
+   */
+  std::unique_ptr<ExodusAsyncWriter> _async_writer;
+
+  /**
+   * Adds boundary id \p id to the libMesh side or shellface of
+   * \p elem corresponding to the 1-based Exodus side \p exodus_side.
+   */
+  void add_exodus_side (const Elem & elem,
+                        int exodus_side,
+                        boundary_id_type id);
 #endif
 
   /**
@@ -162,6 +162,14 @@ public:
    */
   void read_nodes();
 
+  /**
+   * Reads the x,y,z coordinates of the \p n nodes starting at
+   * zero-based index \p first in the \p ExodusII mesh file, storing
+   * them at the beginning of \p x, \p y, and \p z.  Nodal weights
+   * are not read.
+   */
+  void read_partial_nodes(int first, int n);
+
   /**
    * Reads the optional \p node_num_map from the \p ExodusII mesh
    * file.
@@ -224,6 +232,15 @@ public:
    */
   void read_elem_in_block(int block);
 
+  /**
+   * Reads the connectivity of at most \p n elements, starting at
+   * zero-based index \p first within block \p block, into \p connect.
+   * \p num_elem_this_blk is set to the size of the entire block, and
+   * \p connect is left empty if the requested range misses the
+   * block.  Bezier extraction blocks are not supported.
+   */
+  void read_partial_elem_in_block(int block, int first, int n);
+
   /**
    * Read in edge blocks, storing information in the BoundaryInfo object.
    */
@@ -545,6 +562,15 @@ public:
    */
   void set_hdf5_writing(bool write_hdf5);
 
+  /**
+   * Sets the deflate compression \p level, from 0 (the default, no
+   * compression) to 9, and whether the shuffle filter is applied
+   * before compressing, for the variables of files created
+   * afterwards.  Compression is done by HDF5, so this does nothing
+   * unless HDF5 writing is available and enabled.
+   */
+  void set_compression(int level, bool shuffle = true);
+
   /**
    * Sets the value of _write_as_dimension.
    *
@@ -960,6 +986,11 @@ protected:
   // old format.
   bool _write_hdf5;
 
+  // Deflate level and shuffle filter setting for HDF5 files, see
+  // set_compression()
+  int _compression_level;
+  bool _compression_shuffle;
+
   // Set once the elem num map has been read
   int _end_elem_id;
 
@@ -33,6 +33,7 @@ namespace libMesh
 
 // Forward declarations
 class MeshBase;
+class TextTokenizer;
 
 
 
@@ -126,7 +127,7 @@ private:
    * is called by the public interface function and implements
    * reading the file.
    */
-  void read_mesh (std::istream & in);
+  void read_mesh (TextTokenizer & in);
 
   /**
    * This method implements writing a mesh to a
@@ -0,0 +1,245 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_IN_SITU_IO_H
+#define LIBMESH_IN_SITU_IO_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_output.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/enum_elem_type.h"
+
+// C++ includes
+#include <cstddef>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class EquationSystems;
+class MeshBase;
+
+/**
+ * The \p InSituIO class hands each processor's part of a mesh, and
+ * nodal solution values on it, to a user callback instead of writing
+ * them to a file, so that an in situ analysis or staging library
+ * (ADIOS2, ParaView Catalyst, or the like) can consume them while the
+ * simulation runs.
+ *
+ * Every processor publishes its active local elements and the nodes
+ * they touch, as flat arrays which the callback can pass on without
+ * any further copies: node coordinates, element connectivity as
+ * offsets into a list of indices into those nodes (in libMesh node
+ * order), and the values of each variable at each node.  The mesh
+ * arrays are only rebuilt when the mesh has changed since the last
+ * call, see \p mesh_changed(), so output on a fixed mesh only costs
+ * the gathering of the solution values.
+ *
+ * Like the other parallel output formats, every function which
+ * publishes data must be called on every processor; the callback is
+ * then called once on each of them, possibly with an empty piece.
+ *
+ * \date 2024
+ */
+class InSituIO : public MeshOutput<MeshBase>,
+                 public ParallelObject
+{
+public:
+  /**
+   * The type of the user function which consumes the published data;
+   * it is passed this object, whose accessors are valid for the
+   * duration of the call.
+   */
+  typedef std::function<void (const InSituIO &)> Callback;
+
+  /**
+   * Constructor.  Takes a read-only reference to the mesh to publish,
+   * and the function to call with each published step.
+   */
+  InSituIO (const MeshBase & mesh, Callback callback);
+
+  /**
+   * Publishes the mesh, with no variables, under the name \p name.
+   */
+  virtual void write (const std::string & name) override;
+
+  /**
+   * Publishes the mesh and the serialized solution \p soln, as built
+   * by EquationSystems::build_solution_vector(), under the name \p
+   * name.
+   */
+  virtual void write_nodal_data (const std::string & name,
+                                 const std::vector<Number> & soln,
+                                 const std::vector<std::string> & names) override;
+
+  /**
+   * Publishes the mesh and the solution \p parallel_soln, as built by
+   * EquationSystems::build_parallel_solution_vector(), under the name
+   * \p name.  Only the values at this processor's nodes are gathered.
+   */
+  virtual void write_nodal_data (const std::string & name,
+                                 const NumericVector<Number> & parallel_soln,
+                                 const std::vector<std::string> & names) override;
+
+  /**
+   * Publishes the mesh and the solutions of \p es, or of the systems
+   * named in \p system_names if that is not null, as timestep \p
+   * timestep at time \p time.  Intended to be called every timestep
+   * (or every few) of a transient simulation.
+   */
+  void write_timestep (const std::string & name,
+                       const EquationSystems & es,
+                       const int timestep,
+                       const Real time,
+                       const std::set<std::string> * system_names = nullptr);
+
+  /**
+   * \returns The name the current step was published under.
+   */
+  const std::string & name () const { return _name; }
+
+  /**
+   * \returns The timestep of the current step, which stays -1 until
+   * \p write_timestep() is called.
+   */
+  int timestep () const { return _timestep; }
+
+  /**
+   * \returns The time of the current step.
+   */
+  Real time () const { return _time; }
+
+  /**
+   * \returns \p true if the mesh arrays have been rebuilt since the
+   * previous step was published, i.e. always for the first step and
+   * after the mesh is refined, repartitioned or moved, so that the
+   * callback only needs to republish the mesh when this is set.
+   */
+  bool mesh_changed () const { return _mesh_changed; }
+
+  /**
+   * \returns The ids of the published nodes, in increasing order.
+   */
+  const std::vector<dof_id_type> & node_ids () const { return _node_ids; }
+
+  /**
+   * \returns The coordinates of the published nodes, three per node
+   * regardless of LIBMESH_DIM, in the order of \p node_ids().
+   */
+  const std::vector<Real> & coordinates () const { return _coordinates; }
+
+  /**
+   * \returns The ids of the published elements, i.e. the active
+   * elements owned by this processor.
+   */
+  const std::vector<dof_id_type> & elem_ids () const { return _elem_ids; }
+
+  /**
+   * \returns The type of each published element.
+   */
+  const std::vector<ElemType> & elem_types () const { return _elem_types; }
+
+  /**
+   * \returns The subdomain id of each published element.
+   */
+  const std::vector<subdomain_id_type> & subdomain_ids () const { return _subdomain_ids; }
+
+  /**
+   * \returns The offsets into \p connectivity() at which each
+   * published element's nodes start, followed by the total length.
+   */
+  const std::vector<dof_id_type> & connectivity_offsets () const { return _connectivity_offsets; }
+
+  /**
+   * \returns The nodes of each published element, in libMesh order,
+   * as indices into \p node_ids().
+   */
+  const std::vector<dof_id_type> & connectivity () const { return _connectivity; }
+
+  /**
+   * \returns The names of the published variables.
+   */
+  const std::vector<std::string> & variable_names () const { return _variable_names; }
+
+  /**
+   * \returns The values of every published variable at every
+   * published node, node major, i.e. the value of variable \p v at
+   * node \p i is entry \p i*variable_names().size()+v.
+   */
+  const std::vector<Number> & nodal_values () const { return _nodal_values; }
+
+private:
+  /**
+   * Rebuilds the mesh arrays if the mesh has changed since they were
+   * last built.
+   */
+  void update_mesh_arrays ();
+
+  /**
+   * Calls the callback with the current arrays under the name \p name.
+   */
+  void publish (const std::string & name);
+
+  Callback _callback;
+
+  std::string _name;
+
+  int _timestep;
+
+  Real _time;
+
+  /**
+   * Whether the mesh arrays have been rebuilt since the last step,
+   * and the versions of the mesh they were built from.
+   */
+  bool _mesh_changed;
+
+  bool _mesh_arrays_built;
+
+  std::size_t _geometry_version;
+
+  std::size_t _elem_states_version;
+
+  std::vector<dof_id_type> _node_ids;
+
+  std::vector<Real> _coordinates;
+
+  std::vector<dof_id_type> _elem_ids;
+
+  std::vector<ElemType> _elem_types;
+
+  std::vector<subdomain_id_type> _subdomain_ids;
+
+  std::vector<dof_id_type> _connectivity_offsets;
+
+  std::vector<dof_id_type> _connectivity;
+
+  std::vector<std::string> _variable_names;
+
+  std::vector<Number> _nodal_values;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_IN_SITU_IO_H
@@ -34,6 +34,7 @@
 #include <cstddef>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -149,9 +150,12 @@ public:
   virtual ~MeshBase ();
 
   /**
-   * A partitioner to use at each prepare_for_use()
+   * A partitioner to use at each prepare_for_use().  Since the
+   * partitioner may be replaced through this reference, the next
+   * prepare_for_use() will repartition.
    */
-  virtual std::unique_ptr<Partitioner> & partitioner() { return _partitioner; }
+  virtual std::unique_ptr<Partitioner> & partitioner()
+  { _preparation.is_partitioned = false; return _partitioner; }
 
   /**
    * The information about boundary ids on the mesh
@@ -193,10 +197,88 @@ public:
   { return _is_prepared; }
 
   /**
-   * Tells this we have done some operation where we should no longer consider ourself prepared
+   * Tells this we have done some operation where we should no longer
+   * consider ourself prepared.  The next \p prepare_for_use() will
+   * then redo all of its work, rather than skipping whatever is
+   * still up to date.
+   *
+   * Adding, removing, or renumbering elements or nodes is tracked
+   * automatically.  Changes made directly to an element, such as
+   * replacing its nodes or changing its processor id, are not; call
+   * this afterward.  Subdomain ids, boundary ids, and node locations
+   * may be changed freely, since the data which depends on them is
+   * refreshed by every \p prepare_for_use().
    */
   void set_isnt_prepared()
-  { _is_prepared = false; }
+  { _is_prepared = false; this->elems_changed(); }
+
+  /**
+   * \returns A number which changes whenever elements are added to,
+   * removed from, or renumbered in this processor's part of the mesh,
+   * or set_isnt_prepared() is called, so that data derived from the
+   * elements can tell when it has gone out of date.
+   */
+  std::size_t elems_version () const
+  { return _elems_version; }
+
+  /**
+   * Records that elements may have changed owner, been made active
+   * or inactive, or been reordered, without being added or removed,
+   * so that the vectors cached by active_element_vector() and
+   * active_local_element_vector() are rebuilt.  The partitioners,
+   * MeshRefinement, and renumbering call this themselves; call it, or
+   * set_isnt_prepared(), after changing element processor ids or
+   * refinement directly.
+   */
+  void elem_states_changed ()
+  { ++_elem_states_version; }
+
+  /**
+   * \returns A number which changes whenever elem_states_changed() is
+   * called.
+   */
+  std::size_t elem_states_version () const
+  { return _elem_states_version; }
+
+  /**
+   * \returns The active elements, in the order
+   * active_element_ptr_range() visits them, as a plain vector.
+   *
+   * The vector is built on first use and kept until elements are
+   * added, removed, renumbered, repartitioned, refined, or coarsened,
+   * so that loops over it, and ConstElemRange objects built from it,
+   * avoid the type-erased predicate tests the filtered iterators
+   * make at every step.
+   */
+  const std::vector<const Elem *> & active_element_vector () const;
+
+  /**
+   * \returns The active elements owned by this processor, in the
+   * order active_local_element_ptr_range() visits them, as a plain
+   * vector cached as in active_element_vector().
+   */
+  const std::vector<const Elem *> & active_local_element_vector () const;
+
+  /**
+   * Records that nodes have been moved, so that data derived from the
+   * mesh geometry, such as an ElemGeometryCache, can tell it has gone
+   * out of date.  The MeshTools::Modification functions and the mesh
+   * smoothers call this themselves; call it after moving nodes any
+   * other way.
+   *
+   * If a master point locator has been built, it is refit for the
+   * new node positions in place, so that the sub point locators
+   * already handed out stay valid; if it cannot be refit, it is
+   * cleared instead, as clear_point_locator() does.
+   */
+  void nodes_moved ();
+
+  /**
+   * \returns A number which changes whenever elems_version() does or
+   * nodes_moved() is called.
+   */
+  std::size_t geometry_version () const
+  { return _geometry_version; }
 
   /**
    * \returns \p true if all elements and nodes of the mesh
@@ -933,6 +1015,27 @@ public:
    */
   unsigned int n_elem_integers() const { return _elem_integer_names.size(); }
 
+  /**
+   * Fills \p values with the extra element integer \p index of each
+   * of this processor's active elements, in the order of
+   * active_local_element_vector(), so that loops needing it for
+   * every element can read it as a flat array.  The copy is made
+   * with threads.
+   */
+  void get_local_elem_integers (const unsigned int index,
+                                std::vector<dof_id_type> & values) const;
+
+  /**
+   * Sets the extra element integer \p index of each of this
+   * processor's active elements from \p values, in the order of
+   * active_local_element_vector(), using threads, and then updates
+   * every other processor's copies of those elements in one exchange.
+   *
+   * This must be called on all processors at once.
+   */
+  void set_local_elem_integers (const unsigned int index,
+                                const std::vector<dof_id_type> & values);
+
   /**
    * Register a datum (of type T) to be added to each element in the
    * mesh.
@@ -1180,6 +1283,23 @@ public:
   void allow_find_neighbors(bool allow) { _skip_find_neighbors = !allow; }
   bool allow_find_neighbors() const { return !_skip_find_neighbors; }
 
+  /**
+   * If \p true is passed then renumber_nodes_and_elements() will
+   * also reorder elements, and hence their nodes, along a Hilbert
+   * space-filling curve, so that elements and nodes which are close
+   * in space are also close in numbering and in iteration order.
+   * On a distributed mesh each processor reorders only the objects
+   * it owns, within its own block of ids.  Parents are always
+   * numbered before their children.
+   *
+   * This has no effect when renumbering is disabled, and it leaves
+   * the numbering unchanged in builds without libHilbert and MPI.
+   * This is false by default.
+   */
+  void allow_spatial_renumbering(bool allow)
+  { _allow_spatial_renumbering = allow; _preparation.has_renumbered = false; }
+  bool allow_spatial_renumbering() const { return _allow_spatial_renumbering; }
+
   /**
    * If false is passed in then this mesh will no longer have remote
    * elements deleted when being prepared for use; i.e. even a
@@ -1242,7 +1362,8 @@ public:
    * until either the functor is removed or the Mesh is destructed.
    */
   void add_ghosting_functor(GhostingFunctor & ghosting_functor)
-  { _ghosting_functors.insert(&ghosting_functor); }
+  { _ghosting_functors.insert(&ghosting_functor);
+    _preparation.has_reinit_ghosting_functors = false; }
 
   /**
    * Adds a functor which can specify ghosting requirements for use on
@@ -1783,6 +1904,26 @@ protected:
    */
   bool nodes_and_elements_equal(const MeshBase & other_mesh) const;
 
+  /**
+   * Records that elements have been added, removed, or renumbered,
+   * so that every step of \p prepare_for_use() has to be redone.
+   * Called by subclasses from each such operation.
+   */
+  void elems_changed ()
+  { _preparation = Preparation(); ++_elems_version; ++_geometry_version; }
+
+  /**
+   * Records that nodes have been added, removed, or renumbered, so
+   * that \p prepare_for_use() has to redo id counts and node
+   * partitioning.  Called by subclasses from each such operation.
+   */
+  void nodes_changed ()
+  {
+    _preparation.has_synched_id_counts = false;
+    _preparation.has_renumbered = false;
+    _preparation.is_partitioned = false;
+  }
+
   /**
    * \returns A writable reference to the number of partitions.
    */
@@ -1819,6 +1960,65 @@ protected:
    */
   bool _is_prepared;
 
+  /**
+   * Which steps of \p prepare_for_use() are still up to date because
+   * neither elements nor nodes have been added, removed, or
+   * renumbered since they were last done.  A step that was skipped
+   * at the user's request, such as partitioning, stays out of date.
+   */
+  struct Preparation
+  {
+    bool has_synched_id_counts = false;
+    bool has_renumbered = false;
+    bool has_neighbor_ptrs = false;
+    bool has_interior_parent_ptrs = false;
+    bool has_reinit_ghosting_functors = false;
+    bool is_partitioned = false;
+    bool has_removed_remote_elements = false;
+  };
+
+  Preparation _preparation;
+
+  /**
+   * Counts calls to \p elems_changed(), for elems_version().
+   */
+  std::size_t _elems_version = 0;
+
+  /**
+   * Counts calls to \p elems_changed() and \p nodes_moved(), for
+   * geometry_version().
+   */
+  std::size_t _geometry_version = 0;
+
+  /**
+   * Counts calls to \p elem_states_changed().
+   */
+  std::size_t _elem_states_version = 0;
+
+  /**
+   * A vector of elements cached by active_element_vector() or
+   * active_local_element_vector(), with the elems_version() and
+   * elem_states_changed() count it was built at.
+   */
+  struct ElemVectorCache
+  {
+    std::vector<const Elem *> elems;
+    std::size_t elems_version = 0;
+    std::size_t states_version = 0;
+    bool valid = false;
+  };
+
+  /**
+   * Builds \p cache from \p range if it is out of date, and \returns
+   * its elements.
+   */
+  const std::vector<const Elem *> &
+  cached_elem_vector (ElemVectorCache & cache,
+                      const SimpleRange<const_element_iterator> & range) const;
+
+  mutable ElemVectorCache _active_elem_cache;
+  mutable ElemVectorCache _active_local_elem_cache;
+
   /**
    * A \p PointLocator class for this mesh.
    * This will not actually be built unless needed. Further, since we want
@@ -1880,6 +2080,14 @@ protected:
    */
   bool _allow_remote_element_removal;
 
+  /**
+   * If this is true then renumbering will also reorder objects
+   * along a space-filling curve.
+   *
+   * This is false by default.
+   */
+  bool _allow_spatial_renumbering;
+
   /**
    * This structure maintains the mapping of named blocks
    * for file formats that support named blocks.  Currently
@@ -27,6 +27,7 @@
 
 // C++ Includes
 #include <unordered_map>
+#include <vector>
 
 namespace libMesh
 {
@@ -179,6 +180,16 @@ public:
                            const ForwardIterator &,
                            std::unordered_map<dof_id_type, dof_id_type> &) const;
 
+  /**
+   * This method sorts \p objects, which are Nodes or Elems, by the
+   * Hilbert key of their location within the bounding box of all of
+   * them.  Elems are sorted by level first, so that parents come
+   * before their children.  Without libHilbert and MPI the order is
+   * left unchanged.
+   */
+  template <typename T>
+  void sort_by_hilbert_key (std::vector<T *> & objects) const;
+
   /**
    * This method determines a globally unique, partition-agnostic
    * index for each object in the input range.
@@ -198,6 +198,20 @@ public:
                    DenseVector<Number> & output,
                    const std::set<subdomain_id_type> * subdomain_ids);
 
+  /**
+   * Computes values at each of \p points, storing the values at
+   * \p points[i] in \p values[i], optionally restricting the points
+   * to the passed subdomain_ids or else to the internal
+   * subdomain_ids.  The points are grouped by the element containing
+   * them, so each element has its points inverse mapped and its
+   * shape functions computed once, with FE objects reused across
+   * elements.  This is much cheaper than calling \p operator() for
+   * each point when many points share elements.
+   */
+  void evaluate_points (const std::vector<Point> & points,
+                        std::vector<DenseVector<Number>> & values,
+                        const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
   /**
    * Similar to operator() with the same parameter list, but with the difference
    * that multiple values on faces are explicitly permitted. This is useful for
@@ -353,6 +367,14 @@ protected:
   std::set<const Elem *> find_elements(const Point & p,
                                        const std::set<subdomain_id_type> * subdomain_ids = nullptr) const;
 
+  /**
+   * \returns \p element if it is local or if our vector is serial,
+   * and otherwise a local element sharing the point \p p with it, or
+   * \p nullptr if there is none.
+   */
+  const Elem * local_element (const Elem * element,
+                              const Point & p) const;
+
   /**
    * Helper function for finding a gradient as evaluated from a
    * specific element
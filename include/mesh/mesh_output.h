@@ -150,6 +150,22 @@ public:
                                  const EquationSystems &,
                                  const std::set<std::string> *);
 
+  /**
+   * This method may be overridden by serial output formats which can
+   * write their nodal data a piece at a time, as it arrives from
+   * EquationSystems::stream_solution_vector(), rather than needing
+   * the whole solution vector localized on one processor.  It is
+   * called on every processor.
+   *
+   * Formats that override it should also override
+   * can_stream_nodal_data().
+   */
+  virtual void write_nodal_data_streamed (const std::string &,
+                                          const EquationSystems &,
+                                          const std::vector<std::string> &,
+                                          const std::set<std::string> *)
+  { libmesh_not_implemented(); }
+
   /**
    * Return/set the precision to use when writing ASCII files.
    *
@@ -175,6 +191,14 @@ protected:
    */
   virtual bool get_add_sides() { return false; }
 
+  /**
+   * \returns Whether write_equation_systems() should hand the
+   * solution to write_nodal_data_streamed() rather than building a
+   * serial solution vector.  Subclasses should override this if they
+   * implement write_nodal_data_streamed() for their current settings.
+   */
+  virtual bool can_stream_nodal_data() const { return false; }
+
 
   /**
    * Flag specifying whether this format is parallel-capable.
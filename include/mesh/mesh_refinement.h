@@ -29,10 +29,13 @@
 // Local Includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
+#include "libmesh/enum_elem_type.h"
 #include "libmesh/topology_map.h"
 #include "libmesh/parallel_object.h"
 
 // C++ Includes
+#include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace libMesh
@@ -43,6 +46,7 @@ class MeshBase;
 class Point;
 class Node;
 class ErrorVector;
+class DistributedErrorVector;
 class PeriodicBoundaries;
 class Elem;
 class PointLocatorBase;
@@ -198,6 +202,28 @@ public:
                                      const Real coarsen_fraction = 0.0,
                                      const unsigned int max_level = libMesh::invalid_uint);
 
+  /**
+   * Flags elements as \p flag_elements_by_error_fraction() does, but
+   * from errors held only on the active local elements.  Only the
+   * error bounds, and the errors of the parents of local elements if
+   * \p coarsen_by_parents() is set, are communicated; the flags are
+   * set on the local elements and then made parallel consistent.
+   */
+  void flag_elements_by_error_fraction (const DistributedErrorVector & error_per_cell);
+
+  /**
+   * Flags elements as \p flag_elements_by_error_tolerance() does, but
+   * from errors held only on the active local elements.
+   */
+  void flag_elements_by_error_tolerance (const DistributedErrorVector & error_per_cell);
+
+  /**
+   * Flags elements as \p flag_elements_by_mean_stddev() does, but from
+   * errors held only on the active local elements, whose mean and
+   * standard deviation are reduced as single numbers.
+   */
+  void flag_elements_by_mean_stddev (const DistributedErrorVector & error_per_cell);
+
   /**
    * Flag elements based on a function object.  The class \p ElementFlagging
    * defines a mechanism for implementing refinement strategies.
@@ -564,6 +590,11 @@ private:
 
   //------------------------------------------------------
   // "Smoothing" algorithms for refined meshes
+  //
+  // Each of these only works on this processor's copy of the flags,
+  // without any communication, and returns true if it changed any
+  // flags here.  _smooth_flags() iterates them to a local fixed point
+  // and then reduces the result once.
 
   /**
    * This algorithm restricts the maximum level mismatch
@@ -720,6 +751,18 @@ private:
                                    Real & parent_error_min,
                                    Real & parent_error_max);
 
+  /**
+   * Calculates the error on the parents of the active local elements
+   * from errors held only on those elements.  error_per_parent[parent_id]
+   * stores this error if parent_id corresponds to a coarsenable parent,
+   * and stores -1 otherwise.  The squared child errors are summed by
+   * each parent's owner, so only the parents' errors are communicated.
+   */
+  void create_parent_error_map (const DistributedErrorVector & error_per_cell,
+                                std::unordered_map<dof_id_type, ErrorVectorReal> & error_per_parent,
+                                Real & parent_error_min,
+                                Real & parent_error_max);
+
   /**
    * Updates the \p _new_nodes_map
    */
@@ -764,6 +807,51 @@ private:
    */
   TopologyMap _new_nodes_map;
 
+  /**
+   * How the children of one element type, with one embedding matrix
+   * version, are laid out: for each child node, either the parent
+   * node it coincides with, or the pairs of parent nodes bracketing
+   * it and the weights of the parent nodes which place it.  Built
+   * once per type from the embedding matrices, so that add_node()
+   * doesn't rescan them (or lock their caches) for every node.
+   *
+   * Child node \p n of child \p c is entry child_offsets[c]+n, and
+   * its brackets and weights are given by CSR-style offsets.
+   * Templates are \p usable only if every bracketing node is a
+   * parent node, which isn't true for non-full-order elements.
+   */
+  struct RefinementTemplate
+  {
+    bool usable = true;
+    std::vector<unsigned int> child_offsets;
+    std::vector<unsigned int> parent_node;
+    std::vector<unsigned int> bracket_offsets;
+    std::vector<std::pair<unsigned char, unsigned char>> brackets;
+    std::vector<unsigned int> weight_offsets;
+    std::vector<std::pair<unsigned int, Real>> weights;
+  };
+
+  /**
+   * \returns The refinement template for \p parent, building it if
+   * necessary.
+   */
+  const RefinementTemplate & refinement_template (const Elem & parent);
+
+  std::map<std::pair<ElemType, unsigned int>, RefinementTemplate> _refinement_templates;
+
+  /**
+   * The parent for which add_node() last looked up a template, and
+   * that template, since add_node() is called for every node of
+   * every child of a parent in turn.
+   */
+  const Elem * _template_parent = nullptr;
+  const RefinementTemplate * _template = nullptr;
+
+  /**
+   * Scratch space for bracketing node ids in add_node().
+   */
+  std::vector<std::pair<dof_id_type, dof_id_type>> _bracketing_node_ids;
+
   /**
    * Reference to the mesh.
    */
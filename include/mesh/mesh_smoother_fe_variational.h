@@ -0,0 +1,87 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MESH_SMOOTHER_FE_VARIATIONAL_H
+#define LIBMESH_MESH_SMOOTHER_FE_VARIATIONAL_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_smoother.h"
+
+namespace libMesh
+{
+
+/**
+ * A variational mesh smoother which minimizes the same distortion and
+ * dilation energy as VariationalMeshSmoother, but assembles and
+ * solves it as a VariationalSmootherSystem.  Assembly is threaded,
+ * distributed meshes are supported without serialization, and the
+ * Newton iterations use the configured linear solver package, rather
+ * than the serial solver of VariationalMeshSmoother.
+ *
+ * Boundary nodes stay in place.  The problem is solved on a copy of
+ * the mesh, so any EquationSystems already built on the mesh is left
+ * alone; its solutions are not projected onto the moved mesh.
+ *
+ * \date 2024
+ * \brief Variational mesh smoothing through FEMSystem.
+ */
+class FEVariationalMeshSmoother : public MeshSmoother
+{
+public:
+  /**
+   * Constructor.
+   */
+  explicit
+  FEVariationalMeshSmoother (UnstructuredMesh & mesh,
+                             Real dilation_weight = 0.5);
+
+  /**
+   * Destructor.
+   */
+  virtual ~FEVariationalMeshSmoother () = default;
+
+  /**
+   * Moves the interior nodes of the mesh to minimize the mesh energy.
+   */
+  virtual void smooth () override;
+
+  /**
+   * The weight of the dilation metric against the distortion metric,
+   * between 0 and 1.
+   */
+  Real dilation_weight;
+
+  /**
+   * The most Newton iterations to take, and the residual reduction
+   * to stop at.
+   */
+  unsigned int max_iterations;
+  Real relative_residual_tolerance;
+
+  /**
+   * Set to \p false to print the Newton iterations.  Defaults to
+   * \p true.
+   */
+  bool quiet;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MESH_SMOOTHER_FE_VARIATIONAL_H
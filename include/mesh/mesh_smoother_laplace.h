@@ -30,10 +30,22 @@
 namespace libMesh
 {
 
+// Forward declarations
+class Node;
+
 /**
  * This class defines the data structures necessary for Laplace
  * smoothing.
  *
+ * Each sweep moves every interior vertex to the average of the
+ * vertices it shares an edge with, Jacobi style.  The adjacency of
+ * the nodes this processor owns is computed once, by init(), in
+ * compressed row form from the local and ghosted elements; no global
+ * graph is gathered, so this works on a DistributedMesh as long as
+ * the elements around each local node are ghosted, as they are by
+ * default.  Sweeps are threaded over the local nodes, and the ghost
+ * node positions are synchronized after each sweep.
+ *
  * \note This is a simple averaging smoother, which does \e not
  * guarantee that points will be smoothed to valid locations, e.g.
  * locations inside the boundary!  This aspect could use work.
@@ -67,9 +79,12 @@ public:
   /**
    * The actual smoothing function, gets called whenever
    * the user specifies an actual number of smoothing
-   * iterations.
+   * iterations.  Stops early, after the first sweep in which
+   * no node moves further than \p tolerance.
+   *
+   * \returns The number of sweeps taken.
    */
-  void smooth(unsigned int n_iterations);
+  unsigned int smooth(unsigned int n_iterations);
 
   /**
    * Initialization for the Laplace smoothing routine
@@ -86,22 +101,28 @@ public:
    */
   void print_graph(std::ostream & out_stream = libMesh::out) const;
 
-private:
   /**
-   * This function allgather's the (local) graph after
-   * it is computed on each processor by the init() function.
+   * Smoothing stops once a sweep moves no node further than this
+   * distance.  Defaults to 0, so that all sweeps requested are taken
+   * unless the mesh stops changing altogether.
    */
-  void allgather_graph();
+  Real tolerance;
 
+private:
   /**
    * True if the L-graph has been created, false otherwise.
    */
   bool _initialized;
 
   /**
-   * Data structure for holding the L-graph
+   * The L-graph in compressed row form: the neighbors of
+   * _graph_nodes[i] are _graph_neighbors[_graph_offsets[i]] through
+   * _graph_neighbors[_graph_offsets[i+1]-1].  Only the local and
+   * unpartitioned vertices which are free to move have rows.
    */
-  std::vector<std::vector<dof_id_type>> _graph;
+  std::vector<Node *> _graph_nodes;
+  std::vector<std::size_t> _graph_offsets;
+  std::vector<const Node *> _graph_neighbors;
 };
 
 
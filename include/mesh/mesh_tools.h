@@ -25,6 +25,7 @@
 #include "libmesh/bounding_box.h"
 #include "libmesh/id_types.h"
 #include "libmesh/mesh_base.h"
+#include "libmesh/simple_range.h"
 
 // C++ Includes
 #include <limits>
@@ -40,6 +41,7 @@ namespace libMesh
 class Sphere;
 class Elem;
 enum ElemType : int;
+enum ElemQuality : int;
 
 /**
  * Utility functions for operations on a \p Mesh object.  Here is where
@@ -108,6 +110,65 @@ void build_nodes_to_elem_map (const MeshBase & mesh,
 void build_nodes_to_elem_map (const MeshBase & mesh,
                               std::unordered_map<dof_id_type, std::vector<const Elem *>> & nodes_to_elem_map);
 
+/**
+ * A node to element map stored in compressed sparse row form.  This
+ * takes one pointer per element node and one offset per node, rather
+ * than a separately allocated vector for every node, so it is far
+ * smaller than the other maps build_nodes_to_elem_map() can fill.
+ *
+ * On a mesh whose node ids are contiguous from 0, rows are indexed
+ * directly by node id.  Otherwise, as on most distributed meshes,
+ * the ids of the nodes present are also stored, and looked up by
+ * binary search.
+ */
+class CompressedNodesToElemMap
+{
+public:
+  typedef SimpleRange<std::vector<const Elem *>::const_iterator> elem_range;
+
+  /**
+   * \returns The elements containing the node with id \p node_id,
+   * in order of increasing element id.  The node must be on the mesh
+   * the map was built from.
+   */
+  elem_range operator[] (const dof_id_type node_id) const;
+
+  /**
+   * \returns The number of nodes in the map.
+   */
+  std::size_t n_nodes () const
+  { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+
+private:
+  friend void build_nodes_to_elem_map (const MeshBase & mesh,
+                                       CompressedNodesToElemMap & nodes_to_elem_map);
+
+  /**
+   * \returns The row for the node with id \p node_id.
+   */
+  std::size_t row (const dof_id_type node_id) const;
+
+  /**
+   * The id of the node in each row, in increasing order, or empty
+   * if each row's index is its node's id.
+   */
+  std::vector<dof_id_type> _node_ids;
+
+  /**
+   * The elements containing the node in row \p r are entries
+   * \p _offsets[r] through \p _offsets[r+1]-1 of \p _elems.
+   */
+  std::vector<std::size_t> _offsets;
+  std::vector<const Elem *> _elems;
+};
+
+/**
+ * The same, except the map is built in compressed sparse row form,
+ * with the elements split over threads.
+ */
+void build_nodes_to_elem_map (const MeshBase & mesh,
+                              CompressedNodesToElemMap & nodes_to_elem_map);
+
 
 //   /**
 //    * Calling this function on a 2D mesh will convert all the elements
@@ -192,6 +253,39 @@ Sphere
 subdomain_bounding_sphere (const MeshBase & mesh,
                            const subdomain_id_type sid);
 
+/**
+ * The distribution of an element quality metric over the active
+ * elements of a mesh, as computed by compute_quality_histogram().
+ * Bin \p i counts the elements with quality in
+ * [min + i*bin_width(), min + (i+1)*bin_width()); the last bin also
+ * holds the elements attaining \p max.
+ */
+struct QualityHistogram
+{
+  Real min = std::numeric_limits<Real>::max();
+  Real max = -std::numeric_limits<Real>::max();
+  Real mean = 0;
+  dof_id_type n_elem = 0;
+  std::vector<dof_id_type> bins;
+
+  Real bin_width () const
+  { return bins.empty() ? 0 : (max - min) / bins.size(); }
+};
+
+/**
+ * \returns The minimum, mean and maximum of \p Elem::quality(metric)
+ * over the active elements of \p mesh, with a histogram of \p n_bins
+ * equal bins between the minimum and maximum.
+ *
+ * Each processor evaluates the metric on its own active elements, in
+ * a threaded pass, and the results are summed over processors, so
+ * distributed meshes need not be serialized.
+ */
+QualityHistogram
+compute_quality_histogram (const MeshBase & mesh,
+                           const ElemQuality metric,
+                           const unsigned int n_bins = 10);
+
 
 /**
  * Fills in a vector of all element types in the mesh.  Implemented
@@ -328,6 +422,15 @@ void find_nodal_neighbors(const MeshBase & mesh,
                           const std::unordered_map<dof_id_type, std::vector<const Elem *>> & nodes_to_elem_map,
                           std::vector<const Node *> & neighbors);
 
+/**
+ * Given a mesh and a node in the mesh, the vector will be filled with
+ * every node directly attached to the given one.
+ */
+void find_nodal_neighbors(const MeshBase & mesh,
+                          const Node & n,
+                          const CompressedNodesToElemMap & nodes_to_elem_map,
+                          std::vector<const Node *> & neighbors);
+
 /**
  * Given a mesh hanging_nodes will be filled with an associative array keyed off the
  * global id of all the hanging nodes in the mesh.  It will hold an array of the
@@ -370,6 +473,45 @@ void clear_spline_nodes(MeshBase &);
  */
 bool valid_is_prepared (const MeshBase & mesh);
 
+/**
+ * How thoroughly the debugging checks below which compare every
+ * element or node id across processors (libmesh_assert_valid_neighbors(),
+ * libmesh_assert_valid_dof_ids(), etc.) verify the mesh:
+ * FULL_VALIDATION (the default) checks every id,
+ * SAMPLED_VALIDATION checks an evenly spaced sample of ids, shifted
+ * at every call so that repeated checks eventually cover the whole
+ * mesh, and NO_VALIDATION skips those comparisons.  Purely local
+ * checks are unaffected.
+ */
+enum ValidationLevel
+{
+  NO_VALIDATION = 0,
+  SAMPLED_VALIDATION,
+  FULL_VALIDATION
+};
+
+/**
+ * Sets the validation level, and the number of ids checked per call
+ * with SAMPLED_VALIDATION.  This must be called identically on every
+ * processor.
+ *
+ * Unless this is called, the level is read from the command line
+ * option --mesh-validation=(none|sampled|full) and the sample size
+ * from --mesh-validation-samples=N when first needed.
+ */
+void set_validation_level (ValidationLevel level,
+                           unsigned int n_samples = 1000);
+
+/**
+ * \returns The current validation level.
+ */
+ValidationLevel validation_level ();
+
+/**
+ * \returns The number of ids checked per call with SAMPLED_VALIDATION.
+ */
+unsigned int validation_samples ();
+
 ///@{
 
 /**
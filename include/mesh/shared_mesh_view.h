@@ -0,0 +1,175 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_SHARED_MESH_VIEW_H
+#define LIBMESH_SHARED_MESH_VIEW_H
+
+// Local includes
+#include "libmesh/bounding_box.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/id_types.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * A read-only, structure-of-arrays copy of the geometry and
+ * connectivity of a serial mesh, laid out like a CompactMeshView,
+ * but held once per shared-memory node rather than once per rank.
+ *
+ * With MPI-3, the lowest rank on each node allocates the arrays in an
+ * MPI_Win_allocate_shared() window and fills them, and every other
+ * rank on the node maps the same memory read-only.  Without MPI-3
+ * each rank simply holds its own copy.
+ *
+ * Every rank must hold the same mesh, so the mesh must be serial.
+ * Node ids are kept in ascending order, so no per-rank index map is
+ * needed to look nodes up by id.
+ *
+ * Construction and destruction are collective on the mesh
+ * communicator.  Like a CompactMeshView this is a snapshot, and it
+ * must be rebuilt after any modification of the mesh.
+ *
+ * \date 2024
+ * \brief Node-shared flat copy of mesh coordinates and connectivity.
+ */
+class SharedMeshView : public ParallelObject
+{
+public:
+  /**
+   * The active elements of a single type.  The local node indices of
+   * element \p e are connectivity[e*n_nodes] through
+   * connectivity[(e+1)*n_nodes - 1].
+   */
+  struct ElemBlock
+  {
+    ElemType type;
+    unsigned int n_nodes;
+    std::size_t n_elem;
+    const dof_id_type * elem_ids;
+    const dof_id_type * connectivity;
+  };
+
+  /**
+   * Copies the coordinates of every node and the connectivity of
+   * every active element in \p mesh into node-shared memory.
+   */
+  explicit SharedMeshView (const MeshBase & mesh);
+
+  /**
+   * The view refers to memory it owns, so it can't be copied.
+   */
+  SharedMeshView (const SharedMeshView &) = delete;
+  SharedMeshView & operator= (const SharedMeshView &) = delete;
+
+  /**
+   * Releases the shared memory.  This is collective.
+   */
+  ~SharedMeshView ();
+
+  /**
+   * \returns \p true if this rank maps memory filled by another rank
+   * on its node instead of holding its own copy.
+   */
+  bool is_shared () const { return _is_shared; }
+
+  /**
+   * \returns The number of nodes in the view.
+   */
+  std::size_t n_nodes() const { return _n_nodes; }
+
+  /**
+   * \returns The x, y and z coordinates of the nodes, indexed by
+   * local node index.
+   */
+  const Real * x() const { return _x; }
+  const Real * y() const { return _y; }
+  const Real * z() const { return _z; }
+
+  /**
+   * \returns The location of the node with local index \p i.
+   */
+  Point point (std::size_t i) const;
+
+  /**
+   * \returns The mesh id of the node with local index \p i.
+   */
+  dof_id_type node_id (std::size_t i) const { return _node_ids[i]; }
+
+  /**
+   * \returns The local index of the node with mesh id \p id.
+   */
+  dof_id_type local_index (dof_id_type id) const;
+
+  /**
+   * \returns The active element blocks, one per element type present.
+   */
+  const std::vector<ElemBlock> & elem_blocks() const { return _blocks; }
+
+  /**
+   * \returns The bounding box of every node in the view.
+   */
+  BoundingBox bounding_box () const;
+
+private:
+  std::size_t _n_nodes;
+
+  const Real * _x;
+  const Real * _y;
+  const Real * _z;
+
+  const dof_id_type * _node_ids;
+
+  std::vector<ElemBlock> _blocks;
+
+  bool _is_shared;
+
+#if defined(LIBMESH_HAVE_MPI) && MPI_VERSION > 2
+  /**
+   * The shared-memory window holding the arrays.
+   */
+  MPI_Win _win;
+#else
+  /**
+   * Our own copy of the arrays.
+   */
+  std::vector<char> _storage;
+#endif
+};
+
+
+
+// ------------------------------------------------------------
+// SharedMeshView inline methods
+inline
+Point SharedMeshView::point (std::size_t i) const
+{
+  return Point(_x[i], _y[i], _z[i]);
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_SHARED_MESH_VIEW_H
@@ -74,6 +74,15 @@ public:
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) override;
 
+  /**
+   * Writes ASCII nodal data straight from \p es, a slice of nodes at
+   * a time, so that the solution vector is never localized in full.
+   */
+  virtual void write_nodal_data_streamed (const std::string &,
+                                          const EquationSystems &,
+                                          const std::vector<std::string> &,
+                                          const std::set<std::string> *) override;
+
   /**
    * Flag indicating whether or not to write a binary file
    * (if the tecio.a library was found by \p configure).
@@ -106,8 +115,33 @@ public:
    */
   bool & ascii_append ();
 
+protected:
+
+  /**
+   * \returns \p true for ASCII output, which can be streamed.
+   */
+  virtual bool can_stream_nodal_data() const override { return !_binary; }
+
 private:
 
+  /**
+   * Writes the ASCII file header, including the variable names if
+   * \p solution_names is given.
+   */
+  void write_ascii_header (std::ostream & out_stream,
+                           const std::vector<std::string> * solution_names);
+
+  /**
+   * Writes the ASCII lines for the nodes numbered \p first onwards,
+   * one per \p n_vars entries of \p v, or just \p n_nodes points
+   * if \p v is null.
+   */
+  void write_ascii_nodes (std::ostream & out_stream,
+                          dof_id_type first,
+                          dof_id_type n_nodes,
+                          const std::vector<Number> * v,
+                          std::size_t n_vars);
+
   /**
    * This method implements writing a mesh with nodal data to a
    * specified file where the nodal data and variable names are optionally
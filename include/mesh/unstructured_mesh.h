@@ -176,8 +176,9 @@ public:
    * If \p clear_stitched_boundary_ids==true, this function clears boundary_info IDs in this
    * mesh associated \p this_mesh_boundary and \p other_mesh_boundary.
    * If \p use_binary_search is true, we use an optimized "sort then binary search" algorithm
-   * for finding matching nodes. Otherwise we use a N^2 algorithm (which can be more reliable
-   * at dealing with slightly misaligned meshes).
+   * for finding matching nodes. Otherwise we match all nodes within the relative tolerance,
+   * found with a spatial hash (which can be more reliable at dealing with slightly misaligned
+   * meshes).
    * If \p enforce_all_nodes_match_on_boundaries is true, we throw an error if the number of
    * nodes on the specified boundaries don't match the number of nodes that were merged.
    * This is a helpful error check in some cases. If this is true, it overrides the value of
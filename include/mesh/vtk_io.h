@@ -50,8 +50,12 @@ class MeshBase;
  * Format description:
  * cf. <a href="http://www.vtk.org/">VTK home page</a>.
  *
- * This class will not have any functionality unless VTK is detected
- * during configure and hence LIBMESH_HAVE_VTK is defined.
+ * Reading requires VTK to be detected during configure, so that
+ * LIBMESH_HAVE_VTK is defined.  Writing can also be done by a native
+ * writer which streams one .vtu piece per processor, with its arrays
+ * in appended raw binary, plus a .pvtu index written by processor 0.
+ * The native writer is always used when VTK is not available, and
+ * can be selected with \p set_native_output() otherwise.
  *
  * \author Wout Ruijter
  * \author John W. Peterson
@@ -112,13 +116,22 @@ public:
    */
   virtual void write (const std::string &) override;
 
-#ifdef LIBMESH_HAVE_VTK
-
   /**
-   * Setter for compression flag
+   * Setter for compression flag.  The native writer compresses its
+   * arrays with zlib, which is only available when libMesh was
+   * configured with gzstream support.
    */
   void set_compression(bool b);
 
+  /**
+   * If \p native is \p true, files are written with the native
+   * writer rather than through a vtkUnstructuredGrid.  This is the
+   * default, and the only option, when VTK is not available.
+   */
+  void set_native_output(bool native);
+
+#ifdef LIBMESH_HAVE_VTK
+
   /**
    * Get a pointer to the VTK unstructured grid data structure.
    */
@@ -168,11 +181,6 @@ private:
    */
   vtkSmartPointer<vtkUnstructuredGrid> _vtk_grid;
 
-  /**
-   * Flag to indicate whether the output should be compressed
-   */
-  bool _compress;
-
   /**
    * maps global node id to node id of partition
    */
@@ -219,7 +227,27 @@ private:
    */
   static std::map<ElemMappingType, ElementMaps> build_element_maps();
 
-#endif
+#endif // LIBMESH_HAVE_VTK
+
+private:
+  /**
+   * Writes the local piece of the mesh, with the nodal data in
+   * \p soln, directly to a .vtu file, and the .pvtu index of all
+   * the pieces from processor 0.
+   */
+  void write_native (const std::string & fname,
+                     const std::vector<Number> & soln,
+                     const std::vector<std::string> & names);
+
+  /**
+   * Flag to indicate whether the output should be compressed
+   */
+  bool _compress;
+
+  /**
+   * Flag to indicate whether the native writer should be used
+   */
+  bool _native_output;
 };
 
 
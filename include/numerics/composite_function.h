@@ -167,6 +167,26 @@ public:
       component(reverse_index_map[i].second,p,time);
   }
 
+  virtual void component_values (unsigned int i,
+                                 const std::vector<Point> & points,
+                                 Real time,
+                                 std::vector<Output> & values) override
+  {
+    if (i >= reverse_index_map.size() ||
+        reverse_index_map[i].first == libMesh::invalid_uint)
+      {
+        values.assign(points.size(), 0);
+        return;
+      }
+
+    libmesh_assert_less(reverse_index_map[i].first,
+                        subfunctions.size());
+    libmesh_assert_not_equal_to(reverse_index_map[i].second,
+                                libMesh::invalid_uint);
+    subfunctions[reverse_index_map[i].first]->
+      component_values(reverse_index_map[i].second,points,time,values);
+  }
+
   virtual std::unique_ptr<FunctionBase<Output>> clone() const override
   {
     auto returnval = std::make_unique<CompositeFunction>();
@@ -0,0 +1,259 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CSR_MATRIX_H
+#define LIBMESH_CSR_MATRIX_H
+
+// Local includes
+#include "libmesh/sparse_matrix.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <array>
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class DenseMatrix;
+
+/**
+ * A serial sparse matrix stored in compressed sparse row format,
+ * which needs no external solver package.
+ *
+ * The nonzero pattern is taken from the DofMap sparsity pattern when
+ * one is available.  Adding to an entry in the pattern is safe from
+ * multiple threads at once, so threaded assembly loops need no
+ * matrix-wide lock.  Entries outside the pattern may still be set or
+ * added; they are kept aside and merged into the compressed rows by
+ * close().
+ *
+ * Products with a DistributedVector, via
+ * SparseMatrix::vector_mult() and friends, run over rows in parallel
+ * using libMesh threads.
+ *
+ * All overridden virtual functions are documented in sparse_matrix.h.
+ *
+ * \date 2024
+ * \brief Native compressed sparse row matrix.
+ */
+template <typename T>
+class CSRMatrix final : public SparseMatrix<T>
+{
+public:
+  /**
+   * Constructor; initializes the matrix to be empty, without any
+   * structure, i.e.  the matrix is not usable at all. This
+   * constructor is therefore only useful for matrices which are
+   * members of a class. All other matrices should be created at a
+   * point in the data flow where all necessary information is
+   * available.
+   *
+   * You have to initialize the matrix before usage with \p init(...).
+   */
+  explicit CSRMatrix (const Parallel::Communicator & comm);
+
+  /**
+   * The mutexes guarding insertion can't be copied or moved, so
+   * neither can this class; use clone() instead.
+   */
+  CSRMatrix (CSRMatrix &&) = delete;
+  CSRMatrix (const CSRMatrix &) = delete;
+  CSRMatrix & operator= (const CSRMatrix &) = delete;
+  CSRMatrix & operator= (CSRMatrix &&) = delete;
+  virtual ~CSRMatrix () = default;
+  virtual SparseMatrix<T> & operator= (const SparseMatrix<T> &) override
+  {
+    libmesh_not_implemented();
+    return *this;
+  }
+
+  /**
+   * The \p CSRMatrix needs the full sparsity pattern.
+   */
+  virtual bool need_full_sparsity_pattern() const override
+  { return true; }
+
+  /**
+   * Sets up the compressed rows from the DofMap sparsity pattern.
+   */
+  virtual void update_sparsity_pattern (const SparsityPattern::Graph &) override;
+
+  /**
+   * Initializes an \p m by \p n matrix with no stored entries; every
+   * entry added before the first close() ends up in the pattern.
+   * Only serial layouts, with \p m_l == \p m and \p n_l == \p n, are
+   * supported.
+   */
+  virtual void init (const numeric_index_type m,
+                     const numeric_index_type n,
+                     const numeric_index_type m_l,
+                     const numeric_index_type n_l,
+                     const numeric_index_type nnz=30,
+                     const numeric_index_type noz=10,
+                     const numeric_index_type blocksize=1) override;
+
+  virtual void init (ParallelType = PARALLEL) override;
+
+  virtual void clear () override;
+
+  virtual void zero () override;
+
+  virtual std::unique_ptr<SparseMatrix<T>> zero_clone () const override;
+
+  virtual std::unique_ptr<SparseMatrix<T>> clone () const override;
+
+  virtual void close () override;
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual numeric_index_type row_start () const override;
+
+  virtual numeric_index_type row_stop () const override;
+
+  virtual numeric_index_type col_start () const override;
+
+  virtual numeric_index_type col_stop () const override;
+
+  virtual void set (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) override;
+
+  /**
+   * Adds \p value to the \f$ (i,j) \f$ entry.  This may be called
+   * from several threads at once.
+   */
+  virtual void add (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) override;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols) override;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & dof_indices) override;
+
+  virtual void add (const T a, const SparseMatrix<T> & X) override;
+
+  virtual T operator () (const numeric_index_type i,
+                         const numeric_index_type j) const override;
+
+  virtual Real l1_norm () const override;
+
+  virtual Real linfty_norm () const override;
+
+  virtual bool closed() const override { return _closed; }
+
+  virtual std::size_t n_nonzeros() const override { return _values.size(); }
+
+  virtual void print_personal(std::ostream & os=libMesh::out) const override { this->print(os); }
+
+  virtual void get_diagonal (NumericVector<T> & dest) const override;
+
+  virtual void get_transpose (SparseMatrix<T> & dest) const override;
+
+  virtual void get_row(numeric_index_type i,
+                       std::vector<numeric_index_type> & indices,
+                       std::vector<T> & values) const override;
+
+  virtual void zero_rows (std::vector<numeric_index_type> & rows,
+                          T diag_value = 0.0) override;
+
+  /**
+   * Computes \p dest += A * \p arg, with the rows split over threads.
+   */
+  void multiply_add (const std::vector<T> & arg,
+                     std::vector<T> & dest) const;
+
+  /**
+   * Computes \p dest += A^T * \p arg.
+   */
+  void multiply_add_transpose (const std::vector<T> & arg,
+                               std::vector<T> & dest) const;
+
+private:
+
+  /**
+   * Replaces our structure with that of \p sparsity_pattern, with
+   * \p n_cols columns, and zeroes every entry.
+   */
+  void build_pattern (const SparsityPattern::Graph & sparsity_pattern,
+                      numeric_index_type n_cols);
+
+  /**
+   * \returns The position in \p _values of the \f$ (i,j) \f$ entry,
+   * or \p invalid_slot if it isn't in the compressed rows.
+   */
+  std::size_t slot (const numeric_index_type i,
+                    const numeric_index_type j) const;
+
+  /**
+   * Adds \p value to \p _values[s], the slot of an entry in row
+   * \p i, safely with respect to other threads doing the same.
+   */
+  void atomic_add (const numeric_index_type i,
+                   const std::size_t s,
+                   const T value);
+
+  static constexpr std::size_t invalid_slot = static_cast<std::size_t>(-1);
+
+  /**
+   * The matrix dimensions.
+   */
+  numeric_index_type _m, _n;
+
+  /**
+   * The compressed rows: the entries of row \p i are at positions
+   * \p _row_offsets[i] through \p _row_offsets[i+1]-1 of
+   * \p _col_indices, sorted by column, and of \p _values.
+   */
+  std::vector<std::size_t> _row_offsets;
+  std::vector<numeric_index_type> _col_indices;
+  std::vector<T> _values;
+
+  /**
+   * Entries set or added outside the compressed rows since the last
+   * close(), and the mutex guarding them.
+   */
+  std::map<std::pair<numeric_index_type, numeric_index_type>, T> _pending;
+  Threads::spin_mutex _pending_mutex;
+
+  /**
+   * Mutexes guarding additions to entries we can't update
+   * atomically, shared between rows in turn.
+   */
+  static constexpr std::size_t n_row_mutexes = 64;
+  std::array<Threads::spin_mutex, n_row_mutexes> _row_mutexes;
+
+  /**
+   * Flag indicating if the matrix has been closed yet.
+   */
+  bool _closed;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_CSR_MATRIX_H
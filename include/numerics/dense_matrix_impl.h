@@ -22,6 +22,7 @@
 // C++ Includes
 #include <cstdlib> // *must* precede <cmath> for proper std:abs() on PGI, Sun Studio CC
 #include <cmath> // for sqrt
+#include <cstddef>
 
 // Local Includes
 #include "libmesh/dense_matrix.h"
@@ -36,6 +37,88 @@
 namespace libMesh
 {
 
+namespace DenseMatrixKernels
+{
+
+// These work directly on row-major storage, so the inner loops are
+// contiguous and free of bounds checks, which lets compilers
+// vectorize them.  A nonzero N fixes the row length at compile time,
+// for the square element matrix sizes that come up most often, so
+// those loops can also be fully unrolled.
+
+// dest[i] += factor * sum_j A[i*n + j] * x[j], for i < m
+template <unsigned int N, typename T, typename T2, typename T3, typename T4>
+inline
+void matvec_add (unsigned int m, unsigned int n, const T4 factor,
+                 const T * A, const T2 * x, T3 * dest)
+{
+  const unsigned int row_len = N ? N : n;
+  for (unsigned int i = 0; i != m; ++i)
+    {
+      const T * row = A + std::size_t(i) * row_len;
+      T3 sum = 0;
+      for (unsigned int j = 0; j != row_len; ++j)
+        sum += row[j] * x[j];
+      dest[i] += factor * sum;
+    }
+}
+
+// dest[j] += sum_i A[i*n + j] * x[i], for j < n, a row at a time
+template <unsigned int N, typename T, typename T2, typename T3>
+inline
+void matvec_transpose_add (unsigned int m, unsigned int n,
+                           const T * A, const T2 * x, T3 * dest)
+{
+  const unsigned int row_len = N ? N : n;
+  for (unsigned int i = 0; i != m; ++i)
+    {
+      const T * row = A + std::size_t(i) * row_len;
+      const T2 xi = x[i];
+      for (unsigned int j = 0; j != row_len; ++j)
+        dest[j] += row[j] * xi;
+    }
+}
+
+template <typename T, typename T2, typename T3, typename T4>
+inline
+void matvec_add (unsigned int m, unsigned int n, const T4 factor,
+                 const T * A, const T2 * x, T3 * dest)
+{
+  if (m == n)
+    switch (n)
+      {
+      case 4:  return matvec_add<4>(m, n, factor, A, x, dest);
+      case 8:  return matvec_add<8>(m, n, factor, A, x, dest);
+      case 9:  return matvec_add<9>(m, n, factor, A, x, dest);
+      case 20: return matvec_add<20>(m, n, factor, A, x, dest);
+      case 27: return matvec_add<27>(m, n, factor, A, x, dest);
+      default: break;
+      }
+
+  matvec_add<0>(m, n, factor, A, x, dest);
+}
+
+template <typename T, typename T2, typename T3>
+inline
+void matvec_transpose_add (unsigned int m, unsigned int n,
+                           const T * A, const T2 * x, T3 * dest)
+{
+  if (m == n)
+    switch (n)
+      {
+      case 4:  return matvec_transpose_add<4>(m, n, A, x, dest);
+      case 8:  return matvec_transpose_add<8>(m, n, A, x, dest);
+      case 9:  return matvec_transpose_add<9>(m, n, A, x, dest);
+      case 20: return matvec_transpose_add<20>(m, n, A, x, dest);
+      case 27: return matvec_transpose_add<27>(m, n, A, x, dest);
+      default: break;
+      }
+
+  matvec_transpose_add<0>(m, n, A, x, dest);
+}
+
+} // namespace DenseMatrixKernels
+
 
 
 // ------------------------------------------------------------
@@ -313,14 +396,9 @@ void DenseMatrix<T>::vector_mult (DenseVector<T> & dest,
   if (this->use_blas_lapack)
     this->_matvec_blas(1., 0., dest, arg);
   else
-    {
-      const unsigned int n_rows = this->m();
-      const unsigned int n_cols = this->n();
-
-      for (unsigned int i=0; i<n_rows; i++)
-        for (unsigned int j=0; j<n_cols; j++)
-          dest(i) += (*this)(i,j)*arg(j);
-    }
+    DenseMatrixKernels::matvec_add(this->m(), this->n(), T(1),
+                                   _val.data(), arg.get_values().data(),
+                                   dest.get_values().data());
 }
 
 
@@ -341,12 +419,9 @@ void DenseMatrix<T>::vector_mult (DenseVector<typename CompareTypes<T,T2>::super
   if (this->m() == 0 || this->n() == 0)
     return;
 
-  const unsigned int n_rows = this->m();
-  const unsigned int n_cols = this->n();
-
-  for (unsigned int i=0; i<n_rows; i++)
-    for (unsigned int j=0; j<n_cols; j++)
-      dest(i) += (*this)(i,j)*arg(j);
+  DenseMatrixKernels::matvec_add(this->m(), this->n(), T(1),
+                                 _val.data(), arg.get_values().data(),
+                                 dest.get_values().data());
 }
 
 
@@ -371,20 +446,10 @@ void DenseMatrix<T>::vector_mult_transpose (DenseVector<T> & dest,
       this->_matvec_blas(1., 0., dest, arg, /*trans=*/true);
     }
   else
-    {
-      const unsigned int n_rows = this->m();
-      const unsigned int n_cols = this->n();
-
-      // WORKS
-      // for (unsigned int j=0; j<n_cols; j++)
-      //   for (unsigned int i=0; i<n_rows; i++)
-      //     dest(j) += (*this)(i,j)*arg(i);
-
-      // ALSO WORKS, (i,j) just swapped
-      for (unsigned int i=0; i<n_cols; i++)
-        for (unsigned int j=0; j<n_rows; j++)
-          dest(i) += (*this)(j,i)*arg(j);
-    }
+    // Going a row at a time keeps our accesses contiguous
+    DenseMatrixKernels::matvec_transpose_add(this->m(), this->n(),
+                                             _val.data(), arg.get_values().data(),
+                                             dest.get_values().data());
 }
 
 
@@ -405,18 +470,10 @@ void DenseMatrix<T>::vector_mult_transpose (DenseVector<typename CompareTypes<T,
   if (this->m() == 0)
     return;
 
-  const unsigned int n_rows = this->m();
-  const unsigned int n_cols = this->n();
-
-  // WORKS
-  // for (unsigned int j=0; j<n_cols; j++)
-  //   for (unsigned int i=0; i<n_rows; i++)
-  //     dest(j) += (*this)(i,j)*arg(i);
-
-  // ALSO WORKS, (i,j) just swapped
-  for (unsigned int i=0; i<n_cols; i++)
-    for (unsigned int j=0; j<n_rows; j++)
-      dest(i) += (*this)(j,i)*arg(j);
+  // Going a row at a time keeps our accesses contiguous
+  DenseMatrixKernels::matvec_transpose_add(this->m(), this->n(),
+                                           _val.data(), arg.get_values().data(),
+                                           dest.get_values().data());
 }
 
 
@@ -437,9 +494,14 @@ void DenseMatrix<T>::vector_mult_add (DenseVector<T> & dest,
     this->_matvec_blas(factor, 1., dest, arg);
   else
     {
-      DenseVector<T> temp(arg.size());
-      this->vector_mult(temp, arg);
-      dest.add(factor, temp);
+      // Make sure the input sizes are compatible
+      libmesh_assert_equal_to (this->n(), arg.size());
+      libmesh_assert_equal_to (this->m(), dest.size());
+
+      // Accumulate straight into dest, without a temporary
+      DenseMatrixKernels::matvec_add(this->m(), this->n(), factor,
+                                     _val.data(), arg.get_values().data(),
+                                     dest.get_values().data());
     }
 }
 
@@ -458,10 +520,13 @@ void DenseMatrix<T>::vector_mult_add (DenseVector<typename CompareTypes<T, typen
       return;
     }
 
-  DenseVector<typename CompareTypes<T,T3>::supertype>
-    temp(arg.size());
-  this->vector_mult(temp, arg);
-  dest.add(factor, temp);
+  // Make sure the input sizes are compatible
+  libmesh_assert_equal_to (this->n(), arg.size());
+  libmesh_assert_equal_to (this->m(), dest.size());
+
+  DenseMatrixKernels::matvec_add(this->m(), this->n(), factor,
+                                 _val.data(), arg.get_values().data(),
+                                 dest.get_values().data());
 }
 
 
@@ -588,8 +653,7 @@ void DenseMatrix<T>::_lu_back_substitute (const DenseVector<T> & b,
 
   x.resize (n_cols);
 
-  // A convenient reference to *this
-  const DenseMatrix<T> & A = *this;
+  std::vector<T> & x_vals = x.get_values();
 
   // Temporary vector storage.  We use this instead of
   // modifying the RHS.
@@ -602,21 +666,22 @@ void DenseMatrix<T>::_lu_back_substitute (const DenseVector<T> & b,
       if (_pivots[i] != static_cast<pivot_index_t>(i))
         std::swap( z(i), z(_pivots[i]) );
 
-      x(i) = z(i);
-
+      const T * A_row = &_val[std::size_t(i)*n_cols];
+      T x_i = z(i);
       for (unsigned int j=0; j<i; ++j)
-        x(i) -= A(i,j)*x(j);
+        x_i -= A_row[j]*x_vals[j];
 
-      x(i) /= A(i,i);
+      x_vals[i] = x_i / A_row[i];
     }
 
   // Upper-triangular "bottom to top" solve step
-  const unsigned int last_row = n_cols-1;
-
-  for (int i=last_row; i>=0; --i)
+  for (unsigned int i=n_cols; i-- != 0;)
     {
-      for (int j=i+1; j<static_cast<int>(n_cols); ++j)
-        x(i) -= A(i,j)*x(j);
+      const T * A_row = &_val[std::size_t(i)*n_cols];
+      T x_i = x_vals[i];
+      for (unsigned int j=i+1; j<n_cols; ++j)
+        x_i -= A_row[j]*x_vals[j];
+      x_vals[i] = x_i;
     }
 }
 
@@ -691,9 +756,14 @@ void DenseMatrix<T>::_lu_decompose ()
       // If we were scaling the i'th column as well, like
       // in Gaussian elimination, this would 'zero' the
       // entry in the i'th column.
+      const T * pivot_row = &_val[std::size_t(i)*n_rows];
       for (unsigned int row=i+1; row<n_rows; ++row)
-        for (unsigned int col=i+1; col<n_rows; ++col)
-          A(row,col) -= A(row,i) * A(i,col);
+        {
+          T * A_row = &_val[std::size_t(row)*n_rows];
+          const T A_ri = A_row[i];
+          for (unsigned int col=i+1; col<n_rows; ++col)
+            A_row[col] -= A_ri * pivot_row[col];
+        }
 
     } // end i loop
 
@@ -28,6 +28,8 @@
 #include "libmesh/int_range.h"
 #include "libmesh/numeric_vector.h"
 #include "libmesh/parallel.h"
+#include "libmesh/threads.h"
+#include "libmesh/threads_allocators.h"
 
 // C++ includes
 #include <vector>
@@ -47,6 +49,11 @@ namespace libMesh
  * processor. All overridden virtual functions are documented in
  * numeric_vector.h.
  *
+ * Large vectors split their entrywise operations, norms and dot
+ * products over the libMesh threads, in fixed contiguous blocks.
+ * init() zeroes each block from its own thread, so on NUMA systems
+ * each block's memory is placed near the thread which works on it.
+ *
  * \author Benjamin S. Kirk
  * \date 2003
  */
@@ -192,13 +199,19 @@ public:
    */
   using NumericVector<T>::add_vector;
 
-  virtual void add_vector (const NumericVector<T> &,
-                           const SparseMatrix<T> &) override
-  { libmesh_not_implemented(); }
+  /**
+   * Computes \f$ \vec{u} \leftarrow \vec{u} + A \vec{v} \f$.
+   * Only serial vectors and CSRMatrix matrices are supported.
+   */
+  virtual void add_vector (const NumericVector<T> & v,
+                           const SparseMatrix<T> & A) override;
 
-  virtual void add_vector_transpose (const NumericVector<T> &,
-                                     const SparseMatrix<T> &) override
-  { libmesh_not_implemented(); }
+  /**
+   * Computes \f$ \vec{u} \leftarrow \vec{u} + A^T \vec{v} \f$.
+   * Only serial vectors and CSRMatrix matrices are supported.
+   */
+  virtual void add_vector_transpose (const NumericVector<T> & v,
+                                     const SparseMatrix<T> & A) override;
 
   virtual void scale (const T factor) override;
 
@@ -206,6 +219,24 @@ public:
 
   virtual T dot(const NumericVector<T> & V) const override;
 
+  virtual void mdot (const std::vector<const NumericVector<T> *> & vs,
+                     std::vector<T> & dots) const override;
+
+  virtual std::pair<T, Real> dot_and_norm_sq (const NumericVector<T> & v) const override;
+
+  virtual void waxpy (const T alpha,
+                      const NumericVector<T> & x,
+                      const NumericVector<T> & y) override;
+
+  virtual void axpbypcz (const T alpha,
+                         const NumericVector<T> & x,
+                         const T beta,
+                         const NumericVector<T> & y,
+                         const T gamma) override;
+
+  virtual void maxpy (const std::vector<T> & alphas,
+                      const std::vector<const NumericVector<T> *> & vs) override;
+
   virtual void localize (std::vector<T> & v_local) const override;
 
   virtual void localize (NumericVector<T> & v_local) const override;
@@ -236,9 +267,29 @@ public:
 private:
 
   /**
-   * Actual vector datatype to hold vector entries.
+   * The number of blocks threaded_blocks() splits our values into:
+   * one per thread, unless that would leave too few entries in each
+   * block to be worth threading.
    */
-  std::vector<T> _values;
+  unsigned int n_blocks () const;
+
+  /**
+   * Calls \p body(begin, end, b) for each block \p b of our values,
+   * [\p begin, \p end), in parallel over threads.  The blocks depend
+   * only on the local size and the thread count, so with a static
+   * thread schedule every operation reaches each entry from the
+   * thread that first touched it.  Reductions can accumulate into a
+   * slot per block and sum the slots in order afterwards, which
+   * keeps results independent of the thread scheduling.
+   */
+  template <typename Body>
+  void threaded_blocks (const Body & body) const;
+
+  /**
+   * Actual vector datatype to hold vector entries.  Resizing it
+   * leaves plain numbers unwritten, so that init() can place them.
+   */
+  std::vector<T, Threads::first_touch_allocator<T>> _values;
 
   /**
    * The global vector size.
@@ -395,9 +446,11 @@ void DistributedVector<T>::init (const numeric_index_type n,
   // Set the initialized flag
   this->_is_initialized = true;
 
-  // Zero the components unless directed otherwise
-  if (!fast)
-    this->zero();
+  // The new components are unwritten, so zero them whether or not
+  // we're directed to; doing so from the threads which will work on
+  // them places their memory.
+  libmesh_ignore(fast);
+  this->zero();
 }
 
 
@@ -473,9 +526,12 @@ void DistributedVector<T>::zero ()
   libmesh_assert_equal_to (_values.size(), _local_size);
   libmesh_assert_equal_to ((_last_local_index - _first_local_index), _local_size);
 
-  std::fill (_values.begin(),
-             _values.end(),
-             0.);
+  T * values = _values.data();
+  this->threaded_blocks
+    ([values](numeric_index_type begin, numeric_index_type end, unsigned int)
+     {
+       std::fill (values + begin, values + end, T(0));
+     });
 }
 
 
@@ -679,6 +735,48 @@ std::size_t DistributedVector<T>::max_allowed_id () const
   return std::numeric_limits<typename std::vector<T>::size_type>::max();
 }
 
+
+
+template <typename T>
+inline
+unsigned int DistributedVector<T>::n_blocks () const
+{
+  // Smaller blocks cost more in thread startup than they save
+  const std::size_t min_block_size = 8192;
+
+  return cast_int<unsigned int>
+    (std::max(std::size_t(1),
+              std::min(std::size_t(libMesh::n_threads()),
+                       _values.size() / min_block_size)));
+}
+
+
+
+template <typename T>
+template <typename Body>
+inline
+void DistributedVector<T>::threaded_blocks (const Body & body) const
+{
+  const std::size_t n = _values.size();
+  const unsigned int nb = this->n_blocks();
+
+  if (nb == 1)
+    {
+      body(0, cast_int<numeric_index_type>(n), 0);
+      return;
+    }
+
+  Threads::parallel_for
+    (Threads::BlockedRange<unsigned int>(0, nb, 1),
+     [&body, n, nb](const Threads::BlockedRange<unsigned int> & range)
+     {
+       for (unsigned int b = range.begin(); b != range.end(); ++b)
+         body(cast_int<numeric_index_type>(n * b / nb),
+              cast_int<numeric_index_type>(n * (b+1) / nb),
+              b);
+     });
+}
+
 } // namespace libMesh
 
 
@@ -208,6 +208,19 @@ public:
 
   virtual T dot(const NumericVector<T> & v) const override;
 
+  virtual void waxpy (const T alpha,
+                      const NumericVector<T> & x,
+                      const NumericVector<T> & y) override;
+
+  virtual void axpbypcz (const T alpha,
+                         const NumericVector<T> & x,
+                         const T beta,
+                         const NumericVector<T> & y,
+                         const T gamma) override;
+
+  virtual void maxpy (const std::vector<T> & alphas,
+                      const std::vector<const NumericVector<T> *> & vs) override;
+
   virtual void localize (std::vector<T> & v_local) const override;
 
   virtual void localize (NumericVector<T> & v_local) const override;
@@ -24,9 +24,11 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/dense_vector.h" // required to instantiate a DenseVector<> below
 #include "libmesh/fem_context.h"
+#include "libmesh/int_range.h"
 
 // C++ includes
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -125,6 +127,21 @@ public:
                            unsigned int i,
                            const Point & p,
                            Real time=0.);
+
+  /**
+   * Fills \p values with the vector component \p i at each of the
+   * coordinates \p points at time \p time, resizing it as necessary.
+   *
+   * \note The default implementation calls component() at each point;
+   * projections evaluate all the quadrature points of an element,
+   * side or edge with one call, so subclasses can override this to
+   * avoid per-point overhead.
+   */
+  virtual void component_values(const FEMContext &,
+                                unsigned int i,
+                                const std::vector<Point> & points,
+                                Real time,
+                                std::vector<Output> & values);
 };
 
 template <typename Output>
@@ -139,6 +156,19 @@ Output FEMFunctionBase<Output>::component (const FEMContext & context,
   return outvec(i);
 }
 
+template <typename Output>
+inline
+void FEMFunctionBase<Output>::component_values (const FEMContext & context,
+                                                unsigned int i,
+                                                const std::vector<Point> & points,
+                                                Real time,
+                                                std::vector<Output> & values)
+{
+  values.resize(points.size());
+  for (auto p : index_range(points))
+    values[p] = this->component(context, i, points[p], time);
+}
+
 template <typename Output>
 inline
 void FEMFunctionBase<Output>::operator() (const FEMContext & context,
@@ -23,10 +23,12 @@
 // Local Includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/dense_vector.h" // required to instantiate a DenseVector<> below
+#include "libmesh/int_range.h"
 
 // C++ includes
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -146,6 +148,19 @@ public:
                            const Point & p,
                            Real time=0.);
 
+  /**
+   * Fills \p values with the vector component \p i at each of the
+   * coordinates \p points at time \p time, resizing it as necessary.
+   *
+   * \note The default implementation calls component() at each point.
+   * Subclasses with per-call setup costs, such as ParsedFunction, can
+   * override this to pay for that setup once per batch of points.
+   */
+  virtual void component_values(unsigned int i,
+                                const std::vector<Point> & points,
+                                Real time,
+                                std::vector<Output> & values);
+
 
   /**
    * \returns \p true when this object is properly initialized
@@ -240,6 +255,20 @@ Output FunctionBase<Output>::component (unsigned int i,
 
 
 
+template <typename Output>
+inline
+void FunctionBase<Output>::component_values (unsigned int i,
+                                             const std::vector<Point> & points,
+                                             Real time,
+                                             std::vector<Output> & values)
+{
+  values.resize(points.size());
+  for (auto p : index_range(points))
+    values[p] = this->component(i, points[p], time);
+}
+
+
+
 template <typename Output>
 inline
 void FunctionBase<Output>::operator() (const Point & p,
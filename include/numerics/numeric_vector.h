@@ -34,6 +34,7 @@
 // C++ includes
 #include <cstddef>
 #include <set>
+#include <utility>
 #include <vector>
 #include <memory>
 #include <mutex>
@@ -368,6 +369,23 @@ public:
   void get(const std::vector<numeric_index_type> & index,
            std::vector<T> & values) const;
 
+  /**
+   * Access \p n components at once by their positions \p
+   * local_index in this processor's local storage, rather than by
+   * their global indices: for a GHOSTED vector, its owned entries
+   * followed by its ghost entries in the order they were given to
+   * init().  DofMap::ghosted_local_dof_indices() gives these
+   * positions for an element's dofs.
+   *
+   * \returns false, leaving \p values untouched, if this vector
+   * can't be accessed that way; the default implementation never
+   * can.
+   */
+  virtual bool get_local(const numeric_index_type * local_index,
+                         std::size_t n,
+                         T * values) const
+  { libmesh_ignore(local_index, n, values); return false; }
+
   /**
    * Adds \p v to *this,
    * \f$ \vec{u} \leftarrow \vec{u} + \vec{v} \f$.
@@ -578,6 +596,49 @@ public:
    */
   virtual T dot(const NumericVector<T> & v) const = 0;
 
+  /**
+   * \returns The dot products of (*this) with each of the vectors in
+   * \p vs, in \p dots, as dot() would compute them.  Backends may
+   * compute all of them in one pass over (*this) and one parallel
+   * reduction.
+   */
+  virtual void mdot (const std::vector<const NumericVector<T> *> & vs,
+                     std::vector<T> & dots) const;
+
+  /**
+   * \returns The dot product of (*this) with \p v, as dot() would
+   * compute it, paired with the squared l2 norm of \p v.  Backends
+   * may compute both in one pass and one parallel reduction.
+   */
+  virtual std::pair<T, Real> dot_and_norm_sq (const NumericVector<T> & v) const;
+
+  /**
+   * Computes \f$ w \leftarrow \alpha x + y \f$, where \p w is
+   * (*this), in one pass where the backend supports it.
+   */
+  virtual void waxpy (const T alpha,
+                      const NumericVector<T> & x,
+                      const NumericVector<T> & y);
+
+  /**
+   * Computes \f$ z \leftarrow \alpha x + \beta y + \gamma z \f$,
+   * where \p z is (*this), in one pass where the backend supports
+   * it.
+   */
+  virtual void axpbypcz (const T alpha,
+                         const NumericVector<T> & x,
+                         const T beta,
+                         const NumericVector<T> & y,
+                         const T gamma);
+
+  /**
+   * Computes \f$ u \leftarrow u + \sum_i \alpha_i v_i \f$, where \p
+   * u is (*this), \p alphas holds the \f$ \alpha_i \f$ and \p vs the
+   * \f$ v_i \f$, in one pass where the backend supports it.
+   */
+  virtual void maxpy (const std::vector<T> & alphas,
+                      const std::vector<const NumericVector<T> *> & vs);
+
   /**
    * Creates a copy of the global vector in the local vector \p
    * v_local.
@@ -597,6 +658,25 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const = 0;
 
+  /**
+   * Starts localize(v_local, send_list), leaving any communication
+   * of values from other processors in flight where the vector type
+   * allows it, so that other work can overlap it.  \p v_local may
+   * not be accessed until the matching localize_end(); work on
+   * locally owned entries can read them from \p this meanwhile.
+   *
+   * By default this does the whole localize() at once.
+   */
+  virtual void localize_begin (NumericVector<T> & v_local,
+                               const std::vector<numeric_index_type> & send_list) const
+  { this->localize(v_local, send_list); }
+
+  /**
+   * Finishes a localize_begin() into \p v_local.
+   */
+  virtual void localize_end (NumericVector<T> & libmesh_dbg_var(v_local)) const
+  { libmesh_assert(v_local.closed()); }
+
   /**
    * Fill in the local std::vector "v_local" with the global indices
    * given in "indices".
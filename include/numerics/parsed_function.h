@@ -104,6 +104,11 @@ public:
                             const Point & p,
                             Real time) override;
 
+  virtual void component_values (unsigned int i,
+                                 const std::vector<Point> & points,
+                                 Real time,
+                                 std::vector<Output> & values) override;
+
   const std::string & expression() { return _expression; }
 
   /**
@@ -350,6 +355,31 @@ ParsedFunction<Output,OutputGradient>::component (unsigned int i,
   return eval(*parsers[i], "f", i);
 }
 
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::component_values (unsigned int i,
+                                                         const std::vector<Point> & points,
+                                                         Real time,
+                                                         std::vector<Output> & values)
+{
+  libmesh_assert_less (i, parsers.size());
+  FunctionParserADBase<Output> & parser = *parsers[i];
+
+  values.resize(points.size());
+
+  // Only the spatial arguments change from point to point
+  _spacetime[LIBMESH_DIM] = time;
+
+  for (auto p : index_range(points))
+    {
+      for (unsigned int d = 0; d != LIBMESH_DIM; ++d)
+        _spacetime[d] = points[p](d);
+
+      values[p] = eval(parser, "f", i);
+    }
+}
+
 /**
  * \returns The address of a parsed variable so you can supply a parameterized value
  */
@@ -78,9 +78,18 @@ namespace libMesh
 // Forward Declarations
 template <typename T> class DenseMatrix;
 
+/**
+ * The PETSc storage formats PetscMatrix can be initialized with.
+ * \p BAIJ stores dense blocks of the size given at initialization,
+ * and falls back on \p AIJ when that size is 1.  \p SBAIJ also
+ * stores blocks, but keeps only the upper triangle of a symmetric
+ * matrix; entries added below the diagonal are ignored.
+ */
 enum PetscMatrixType : int {
                  AIJ=0,
-                 HYPRE};
+                 HYPRE,
+                 BAIJ,
+                 SBAIJ};
 
 
 /**
@@ -133,8 +142,47 @@ public:
   PetscMatrix & operator= (const PetscMatrix &);
   virtual SparseMatrix<T> & operator= (const SparseMatrix<T> & v) override;
 
+  /**
+   * Sets the storage format used by the next \p init().  With
+   * \p BAIJ or \p SBAIJ, \p init(ParallelType) uses the block size
+   * of the DofMap, which is the number of variables when they all
+   * form a single variable group.
+   */
   void set_matrix_type(PetscMatrixType mat_type);
 
+  /**
+   * If \p use_coo is \p true, add_matrix() uses PETSc's coordinate
+   * (COO) assembly interface, which avoids searching for the
+   * location of each entry.
+   *
+   * The indices passed to add_matrix() during one assembly are
+   * recorded, and those values are inserted as usual.  At the next
+   * zero() the recorded indices become the nonzero pattern of the
+   * matrix, via MatSetPreallocationCOO().  In later assemblies which
+   * add_matrix() the same index sets in the same order, as a serial
+   * element loop does, each value is just written into a flat array,
+   * and close() hands that array to MatSetValuesCOO().  If the
+   * sequence ever differs, the rest of that assembly is inserted as
+   * usual and recorded as the next pattern, so results are always
+   * correct.
+   *
+   * Other insertion methods still work, but entries outside the COO
+   * pattern are slower to add.  Requires PETSc 3.17 or later.
+   *
+   * Unless this is called first, init() turns COO assembly on for
+   * device matrix types chosen with -mat_type, such as aijcusparse,
+   * aijhipsparse or aijkokkos.  Those copy the values from every
+   * MatSetValues() call to the device, where MatSetValuesCOO() copies
+   * a whole assembly at once and scatters it on the device.
+   */
+  void use_coo_assembly (bool use_coo);
+
+  /**
+   * \returns \p true if the matrix type, which -mat_type may have
+   * changed, stores its values on a GPU.
+   */
+  bool on_device () const;
+
   virtual void init (const numeric_index_type m,
                      const numeric_index_type n,
                      const numeric_index_type m_l,
@@ -379,6 +427,91 @@ private:
 
   PetscMatrixType _mat_type;
 
+  /**
+   * The block size of our storage if we were initialized with a
+   * blocked format, or 1 otherwise.
+   */
+  PetscInt _blocked_storage_size;
+
+  /**
+   * \returns \p true if we should use a blocked format for a matrix
+   * with block size \p blocksize.
+   */
+  bool use_blocked_storage (PetscInt blocksize) const;
+
+  /**
+   * Creates blocked (BAIJ or SBAIJ) storage for \p _mat, which must
+   * already have its sizes set, from the per-row counts in \p n_nz
+   * and \p n_oz, or from the constant counts \p nnz and \p noz if
+   * those are empty.
+   */
+  void init_blocked_storage (PetscInt blocksize,
+                             PetscInt nnz,
+                             PetscInt noz,
+                             const std::vector<numeric_index_type> & n_nz,
+                             const std::vector<numeric_index_type> & n_oz);
+
+  /**
+   * Adds \p dm with MatSetValuesBlocked(), if \p rows and \p cols
+   * each cover whole blocks of our storage.
+   *
+   * \returns \p true if the values were added.
+   */
+  bool add_matrix_blocked (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols);
+
+  /**
+   * Adds \p dm through the COO assembly state described in
+   * use_coo_assembly().
+   *
+   * \returns \p true if the values were stored for close(), or
+   * \p false if the caller should insert them as usual.
+   */
+  bool add_matrix_coo (const DenseMatrix<T> & dm,
+                       const std::vector<numeric_index_type> & rows,
+                       const std::vector<numeric_index_type> & cols);
+
+  /**
+   * Resets all COO assembly state, forgetting any pattern.
+   */
+  void clear_coo () noexcept;
+
+  /**
+   * \p true if add_matrix() should use COO assembly, and \p true if
+   * that was chosen by use_coo_assembly() rather than by default.
+   */
+  bool _use_coo_assembly;
+  bool _coo_assembly_chosen;
+
+  /**
+   * \p true once \p _coo_rows and \p _coo_cols have been given to
+   * MatSetPreallocationCOO().
+   */
+  bool _coo_preallocated;
+
+  /**
+   * \p true while the current assembly is being recorded into
+   * \p _coo_new_rows and \p _coo_new_cols, and \p true after it is
+   * closed until that pattern is preallocated.
+   */
+  bool _coo_recording;
+  bool _coo_recorded;
+
+  /**
+   * The row and column of each entry of the preallocated pattern,
+   * and of the pattern being recorded.
+   */
+  std::vector<PetscInt> _coo_rows, _coo_cols;
+  std::vector<PetscInt> _coo_new_rows, _coo_new_cols;
+
+  /**
+   * The values to hand to MatSetValuesCOO(), one per pattern entry,
+   * and the number of entries the current assembly has reached.
+   */
+  std::vector<PetscScalar> _coo_values;
+  std::size_t _coo_cursor;
+
 #ifdef LIBMESH_HAVE_CXX11_THREAD
   mutable std::mutex _petsc_matrix_mutex;
 #else
@@ -207,6 +207,14 @@ public:
   virtual void get(const std::vector<numeric_index_type> & index,
                    T * values) const override;
 
+  /**
+   * GHOSTED vectors read straight from their local form array;
+   * others can't be accessed by local position.
+   */
+  virtual bool get_local(const numeric_index_type * local_index,
+                         std::size_t n,
+                         T * values) const override;
+
   /**
    * Get read/write access to the raw PETSc Vector data array.
    *
@@ -294,6 +302,39 @@ public:
 
   virtual T dot(const NumericVector<T> & v) const override;
 
+  /**
+   * Uses VecMDot, with a single reduction for all of \p vs.
+   */
+  virtual void mdot (const std::vector<const NumericVector<T> *> & vs,
+                     std::vector<T> & dots) const override;
+
+  /**
+   * Uses VecDotNorm2.
+   */
+  virtual std::pair<T, Real> dot_and_norm_sq (const NumericVector<T> & v) const override;
+
+  /**
+   * Uses VecWAXPY, unless (*this) is \p x or \p y.
+   */
+  virtual void waxpy (const T alpha,
+                      const NumericVector<T> & x,
+                      const NumericVector<T> & y) override;
+
+  /**
+   * Uses VecAXPBYPCZ.
+   */
+  virtual void axpbypcz (const T alpha,
+                         const NumericVector<T> & x,
+                         const T beta,
+                         const NumericVector<T> & y,
+                         const T gamma) override;
+
+  /**
+   * Uses VecMAXPY.
+   */
+  virtual void maxpy (const std::vector<T> & alphas,
+                      const std::vector<const NumericVector<T> *> & vs) override;
+
   /**
    * \returns The dot product of (*this) with the vector \p v.
    *
@@ -308,6 +349,16 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const override;
 
+  /**
+   * When \p v_local is GHOSTED and this vector is PARALLEL, copies
+   * the local entries and starts the update of the ghost entries,
+   * leaving it to localize_end() to finish.
+   */
+  virtual void localize_begin (NumericVector<T> & v_local,
+                               const std::vector<numeric_index_type> & send_list) const override;
+
+  virtual void localize_end (NumericVector<T> & v_local) const override;
+
   virtual void localize (std::vector<T> & v_local,
                          const std::vector<numeric_index_type> & indices) const override;
 
@@ -1149,6 +1200,28 @@ void PetscVector<T>::get(const std::vector<numeric_index_type> & index,
 }
 
 
+
+template <typename T>
+inline
+bool PetscVector<T>::get_local(const numeric_index_type * local_index,
+                               std::size_t n,
+                               T * values) const
+{
+  if (this->type() != GHOSTED)
+    return false;
+
+  this->_get_array(true);
+
+  for (std::size_t i=0; i<n; i++)
+    {
+      libmesh_assert_less (local_index[i], _local_size);
+      values[i] = static_cast<T>(_read_only_values[local_index[i]]);
+    }
+
+  return true;
+}
+
+
 template <typename T>
 inline
 PetscScalar * PetscVector<T>::get_array()
@@ -28,6 +28,7 @@
 // C++ includes
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -90,6 +91,13 @@ public:
                             Real time=0.) override
   { return _func->component(i, p, time); }
 
+  virtual void component_values (const FEMContext &,
+                                 unsigned int i,
+                                 const std::vector<Point> & points,
+                                 Real time,
+                                 std::vector<Output> & values) override
+  { _func->component_values(i, points, time, values); }
+
 protected:
 
   std::unique_ptr<FunctionBase<Output>> _func;
@@ -33,6 +33,8 @@
 
 // C++ includes
 #include <map> // FIXME - pid > comm.size() breaks with unordered_map
+#include <tuple>
+#include <utility>
 #include <vector>
 
 
@@ -108,6 +110,31 @@ void sync_dofobject_data_by_id(const Communicator & comm,
                                const DofObjectCheckFunctor & dofobj_check,
                                SyncFunctor &    sync);
 
+/**
+ * Request data about a range of ghost dofobjects uniquely identified
+ * by their id, for two or more independent sync functors at once.
+ * Each functor is used just as in the single functor version, but
+ * the requests and responses for all of them are combined, so there
+ * is one round of communication rather than one per functor.
+ *
+ * The functors must not depend on each other's results, since each
+ * processor gathers data for every functor before any of them act on
+ * data.  Their datum types are combined in a std::tuple, so each must
+ * have a fixed size.
+ */
+template <typename Iterator,
+          typename DofObjectCheckFunctor,
+          typename SyncFunctor1,
+          typename SyncFunctor2,
+          typename... SyncFunctors>
+void sync_dofobject_data_by_id(const Communicator & comm,
+                               const Iterator & range_begin,
+                               const Iterator & range_end,
+                               const DofObjectCheckFunctor & dofobj_check,
+                               SyncFunctor1 &   sync1,
+                               SyncFunctor2 &   sync2,
+                               SyncFunctors &... syncs);
+
 //------------------------------------------------------------------------
 /**
  * Request data about a range of ghost elements uniquely
@@ -352,28 +379,16 @@ void sync_dofobject_data_by_xyz(const Communicator & comm,
 
 
 
-template <typename Iterator,
-          typename SyncFunctor>
-void sync_dofobject_data_by_id(const Communicator & comm,
-                               const Iterator & range_begin,
-                               const Iterator & range_end,
-                               SyncFunctor &    sync)
-{
-  sync_dofobject_data_by_id(comm, range_begin, range_end, SyncEverything(), sync);
-}
+namespace detail {
 
 template <typename Iterator,
-          typename DofObjectCheckFunctor,
-          typename SyncFunctor>
-void sync_dofobject_data_by_id(const Communicator & comm,
-                               const Iterator & range_begin,
-                               const Iterator & range_end,
-                               const DofObjectCheckFunctor & dofobj_check,
-                               SyncFunctor &    sync)
+          typename DofObjectCheckFunctor>
+void request_ids_by_proc(const Communicator & comm,
+                         const Iterator & range_begin,
+                         const Iterator & range_end,
+                         const DofObjectCheckFunctor & dofobj_check,
+                         std::map<processor_id_type, std::vector<dof_id_type>> & requested_objs_id)
 {
-  // This function must be run on all processors at once
-  libmesh_parallel_only(comm);
-
   // Count the objects to ask each processor about
   std::map<processor_id_type, dof_id_type>
     ghost_objects_from_proc;
@@ -393,10 +408,6 @@ void sync_dofobject_data_by_id(const Communicator & comm,
         ghost_objects_from_proc[obj_procid]++;
     }
 
-  // Request sets to send to each processor
-  std::map<processor_id_type, std::vector<dof_id_type>>
-    requested_objs_id;
-
   // We know how many objects live on each processor, so reserve()
   // space for each.
   for (auto pair : ghost_objects_from_proc)
@@ -420,6 +431,89 @@ void sync_dofobject_data_by_id(const Communicator & comm,
 
       requested_objs_id[obj_procid].push_back(obj->id());
     }
+}
+
+
+
+// Fills entry I of each tuple in \p data from \p sync
+template <std::size_t I, typename SyncFunctor, typename Datum>
+void gather_data_column(SyncFunctor & sync,
+                        const std::vector<dof_id_type> & ids,
+                        std::vector<Datum> & data)
+{
+  std::vector<typename SyncFunctor::datum> column;
+  sync.gather_data(ids, column);
+  libmesh_assert_equal_to(column.size(), ids.size());
+
+  for (auto i : index_range(ids))
+    std::get<I>(data[i]) = column[i];
+}
+
+template <typename SyncTuple, std::size_t... I, typename Datum>
+void gather_data_columns(SyncTuple & syncs,
+                         std::index_sequence<I...>,
+                         const std::vector<dof_id_type> & ids,
+                         std::vector<Datum> & data)
+{
+  data.resize(ids.size());
+  (gather_data_column<I>(std::get<I>(syncs), ids, data), ...);
+}
+
+
+
+// Hands entry I of each tuple in \p data to \p sync
+template <std::size_t I, typename SyncFunctor, typename Datum>
+void act_on_data_column(SyncFunctor & sync,
+                        const std::vector<dof_id_type> & ids,
+                        const std::vector<Datum> & data)
+{
+  std::vector<typename SyncFunctor::datum> column(ids.size());
+  for (auto i : index_range(ids))
+    column[i] = std::get<I>(data[i]);
+
+  sync.act_on_data(ids, column);
+}
+
+template <typename SyncTuple, std::size_t... I, typename Datum>
+void act_on_data_columns(SyncTuple & syncs,
+                         std::index_sequence<I...>,
+                         const std::vector<dof_id_type> & ids,
+                         const std::vector<Datum> & data)
+{
+  (act_on_data_column<I>(std::get<I>(syncs), ids, data), ...);
+}
+
+} // namespace detail
+
+
+
+template <typename Iterator,
+          typename SyncFunctor>
+void sync_dofobject_data_by_id(const Communicator & comm,
+                               const Iterator & range_begin,
+                               const Iterator & range_end,
+                               SyncFunctor &    sync)
+{
+  sync_dofobject_data_by_id(comm, range_begin, range_end, SyncEverything(), sync);
+}
+
+template <typename Iterator,
+          typename DofObjectCheckFunctor,
+          typename SyncFunctor>
+void sync_dofobject_data_by_id(const Communicator & comm,
+                               const Iterator & range_begin,
+                               const Iterator & range_end,
+                               const DofObjectCheckFunctor & dofobj_check,
+                               SyncFunctor &    sync)
+{
+  // This function must be run on all processors at once
+  libmesh_parallel_only(comm);
+
+  // Request sets to send to each processor
+  std::map<processor_id_type, std::vector<dof_id_type>>
+    requested_objs_id;
+  detail::request_ids_by_proc(comm, range_begin, range_end, dofobj_check,
+                              requested_objs_id);
 
   auto gather_functor =
     [&sync]
@@ -446,6 +540,60 @@ void sync_dofobject_data_by_id(const Communicator & comm,
 
 
 
+template <typename Iterator,
+          typename DofObjectCheckFunctor,
+          typename SyncFunctor1,
+          typename SyncFunctor2,
+          typename... SyncFunctors>
+void sync_dofobject_data_by_id(const Communicator & comm,
+                               const Iterator & range_begin,
+                               const Iterator & range_end,
+                               const DofObjectCheckFunctor & dofobj_check,
+                               SyncFunctor1 &   sync1,
+                               SyncFunctor2 &   sync2,
+                               SyncFunctors &... syncs)
+{
+  // This function must be run on all processors at once
+  libmesh_parallel_only(comm);
+
+  std::map<processor_id_type, std::vector<dof_id_type>>
+    requested_objs_id;
+  detail::request_ids_by_proc(comm, range_begin, range_end, dofobj_check,
+                              requested_objs_id);
+
+  // Every functor's datum for an object travels together
+  typedef std::tuple<typename SyncFunctor1::datum,
+                     typename SyncFunctor2::datum,
+                     typename SyncFunctors::datum...> datum;
+
+  auto all_syncs = std::tie(sync1, sync2, syncs...);
+  const auto columns =
+    std::make_index_sequence<std::tuple_size<datum>::value>();
+
+  auto gather_functor =
+    [&all_syncs, &columns]
+    (processor_id_type, const std::vector<dof_id_type> & ids,
+     std::vector<datum> & data)
+    {
+      detail::gather_data_columns(all_syncs, columns, ids, data);
+    };
+
+  auto action_functor =
+    [&all_syncs, &columns]
+    (processor_id_type, const std::vector<dof_id_type> & ids,
+     const std::vector<datum> & data)
+    {
+      detail::act_on_data_columns(all_syncs, columns, ids, data);
+    };
+
+  // Trade requests with other processors
+  datum * ex = nullptr;
+  pull_parallel_vector_data
+    (comm, requested_objs_id, gather_functor, action_functor, ex);
+}
+
+
+
 // If there's no refined elements, there's nothing to sync
 #ifdef LIBMESH_ENABLE_AMR
 template <typename Iterator,
@@ -122,11 +122,19 @@ private:
   std::vector<KeyType> _my_bin;
 
   /**
-   * Sorts the local data into bins across all processors.
-   * Right now it constructs a BinSorter<KeyType> object.
-   * In the future this could be a template parameter.
+   * The offsets in _my_bin at which each sorted run received
+   * from another processor begins, followed by _my_bin.size().
    */
-  void binsort ();
+  std::vector<std::size_t> _run_offsets;
+
+  /**
+   * Splits the local data into one bin per processor, using
+   * splitters chosen from a regular sample of every processor's
+   * sorted data.  Choosing the splitters takes a single allgather
+   * of the samples, and works directly on the keys rather than on a
+   * floating point histogram of them.
+   */
+  void samplesort ();
 
   /**
    * Communicates the bins from each processor to the
@@ -138,8 +146,8 @@ private:
 
   /**
    * After all the bins have been communicated, we can
-   * sort our local bin.  This is nothing more than a
-   * call to std::sort
+   * sort our local bin.  Each bin we received is already
+   * sorted, so this just merges those runs.
    */
   void sort_local_bin();
 
@@ -23,6 +23,9 @@
 #include "libmesh/libmesh_config.h"
 #include "libmesh/libmesh_common.h"  // for libmesh_assert
 
+// C++ includes
+#include <vector>
+
 
 // Compile-time check: TBB and pthreads are now mutually exclusive.
 #if defined(LIBMESH_HAVE_TBB_API) && defined(LIBMESH_HAVE_PTHREAD)
@@ -64,7 +67,9 @@ private:
 /**
  * We use a class to turn perf logging off and on within threads, to
  * be exception-safe and to avoid forcing indirect inclusion of
- * libmesh_logging.h everywhere.
+ * libmesh_logging.h everywhere.  If PerfLog::enable_thread_logging()
+ * has been called, logging stays on and each thread logs to its own
+ * per-thread log instead.
  *
  * If we have logging disabled, constructing this class should do
  * nothing; [[maybe_unused]] disables warnings about that.
@@ -277,6 +282,18 @@ extern spin_mutex spin_mtx;
  */
 extern recursive_mutex recursive_mtx;
 
+/**
+ * Pins each thread libMesh runs work on to one logical cpu: the
+ * calling thread to \p cpus[0], and the t-th thread of the pthread
+ * pool, OpenMP team or TBB arena to \p cpus[t], wrapping around if
+ * there are more threads than cpus.  LibMeshInit calls this for the
+ * --bind-threads and --thread-cpus options.
+ *
+ * \returns \p false if thread binding is unsupported on this
+ * platform, or if any thread could not be bound.
+ */
+bool bind_threads (const std::vector<unsigned int> & cpus);
+
 } // namespace Threads
 
 } // namespace libMesh
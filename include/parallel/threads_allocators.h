@@ -33,6 +33,8 @@
 // C++ includes
 #include <memory> // for std::allocator
 #include <cstddef> // std::ptrdiff_t
+#include <new> // placement new
+#include <utility> // std::forward
 
 namespace libMesh
 {
@@ -123,6 +125,47 @@ public:
 
 #endif // #ifdef LIBMESH_HAVE_TBB_API
 
+
+
+/**
+ * An allocator which default-initializes rather than
+ * value-initializes, so that resizing a container of plain numbers
+ * allocates memory without writing to it.  On NUMA systems each page
+ * is then placed near the first thread to write to it, which lets a
+ * container be zeroed, and its pages placed, by the threads which
+ * will later work on each part of it.
+ */
+template <typename T>
+class first_touch_allocator : public std::allocator<T>
+{
+public:
+  typedef T value_type;
+
+  template<typename U>
+  struct rebind
+  {
+    typedef first_touch_allocator<U> other;
+  };
+
+  first_touch_allocator () = default;
+
+  template<typename U>
+  first_touch_allocator(const first_touch_allocator<U> & a) :
+    std::allocator<T>(a) {}
+
+  template <typename U>
+  void construct (U * p)
+  {
+    ::new(static_cast<void *>(p)) U;
+  }
+
+  template <typename U, typename... Args>
+  void construct (U * p, Args &&... args)
+  {
+    ::new(static_cast<void *>(p)) U(std::forward<Args>(args)...);
+  }
+};
+
 } // namespace Threads
 
 } // namespace libMesh
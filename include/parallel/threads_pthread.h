@@ -33,6 +33,7 @@
 
 #include <pthread.h>
 #include <algorithm>
+#include <functional>
 #include <vector>
 #include <memory> // std::unique_ptr, std::make_unique
 
@@ -210,53 +211,120 @@ private:
   pthread_mutexattr_t attr;
 };
 
-template <typename Range>
-unsigned int num_pthreads(Range & range)
-{
-  std::size_t min = std::min((std::size_t)libMesh::n_threads(), range.size());
-  return min > 0 ? cast_int<unsigned int>(min) : 1;
-}
-
-template <typename Range, typename Body>
-class RangeBody
+/**
+ * Scheduler to manage threads.  Constructing one, as LibMeshInit
+ * does, starts a persistent pool of \p n_threads-1 worker threads
+ * which parallel_for() and parallel_reduce() hand their work to;
+ * destroying it stops them again.  Without a running pool, the work
+ * of every thread is done on the calling thread.
+ */
+class task_scheduler_init
 {
 public:
-  Range * range;
-  Body * body;
+  static const int automatic = -1;
+  explicit task_scheduler_init (int n_threads = automatic);
+  ~task_scheduler_init ();
+  void initialize (int n_threads = automatic);
+  void terminate ();
+
+private:
+  bool _started_pool;
 };
 
-template <typename Range, typename Body>
-void * run_body(void * args)
-{
-  RangeBody<Range, Body> * range_body = (RangeBody<Range, Body> *)args;
+//-------------------------------------------------------------------
+/**
+ * Dummy "splitting object" used to distinguish splitting constructors
+ * from copy constructors.
+ */
+class split {};
 
-  Body & body = *range_body->body;
-  Range & range = *range_body->range;
 
-  body(range);
 
-  return nullptr;
-}
+/**
+ * Runs \p job(t) for every \p t in [0, \p n_workers) at once: \p
+ * job(0) on the calling thread and the rest on the thread pool's
+ * workers, or on OpenMP threads if libMesh was built with OpenMP.
+ * Returns once every call has; an exception thrown by any call is
+ * rethrown here.
+ *
+ * \returns The number of calls made, which is less than \p n_workers
+ * if there are fewer threads to make them on.
+ */
+unsigned int run_workers (unsigned int n_workers,
+                          const std::function<void (unsigned int)> & job);
+
+
 
 /**
- * Scheduler to manage threads.
+ * Work-stealing queues of chunk indices.  The chunks [0, \p n_chunks)
+ * are dealt out to \p n_workers queues in contiguous blocks; each
+ * worker takes chunks from the front of its own queue, and once that
+ * is empty steals from the back of the others', so that workers whose
+ * chunks were cheap help out those whose chunks were not.
  */
-class task_scheduler_init
+class ChunkQueues
 {
 public:
-  static const int automatic = -1;
-  explicit task_scheduler_init (int = automatic) {}
-  void initialize (int = automatic) {}
-  void terminate () {}
+  ChunkQueues (unsigned int n_workers, std::size_t n_chunks);
+
+  /**
+   * Sets \p chunk to the next chunk for worker \p worker to run.
+   *
+   * \returns \p false once no chunks are left anywhere.
+   */
+  bool next (unsigned int worker, std::size_t & chunk);
+
+private:
+  struct Queue
+  {
+    spin_mutex mutex;
+    std::size_t begin, end;
+  };
+
+  const unsigned int _n_workers;
+  std::unique_ptr<Queue[]> _queues;
 };
 
-//-------------------------------------------------------------------
+
+
 /**
- * Dummy "splitting object" used to distinguish splitting constructors
- * from copy constructors.
+ * Splits \p range recursively, as a TBB partitioner would, into
+ * subranges no smaller than its grain size allows and no larger than
+ * needed to give each of \p n_threads threads several chunks to
+ * balance between them.  The chunks are appended to \p chunks in
+ * order.
  */
-class split {};
-
+template <typename Range>
+void split_range (const Range & range,
+                  unsigned int n_threads,
+                  std::vector<std::unique_ptr<Range>> & chunks)
+{
+  // Enough chunks per thread to even out uneven costs, not so many
+  // that handing them out costs more than running them
+  const std::size_t chunks_per_thread = 8;
+  const std::size_t target_size =
+    std::max(std::size_t(1),
+             std::size_t(range.size()) / (chunks_per_thread * n_threads));
+
+  std::vector<std::unique_ptr<Range>> to_split;
+  to_split.push_back(std::make_unique<Range>(range));
+
+  // Depth first, right half last, so that chunks stay in order
+  while (!to_split.empty())
+    {
+      std::unique_ptr<Range> left = std::move(to_split.back());
+      to_split.pop_back();
+
+      if (left->is_divisible() && std::size_t(left->size()) > target_size)
+        {
+          auto right = std::make_unique<Range>(*left, Threads::split());
+          to_split.push_back(std::move(right));
+          to_split.push_back(std::move(left));
+        }
+      else
+        chunks.push_back(std::move(left));
+    }
+}
 
 
 
@@ -280,64 +348,20 @@ void parallel_for (const Range & range, const Body & body)
 
   DisablePerfLogInScope disable_perf;
 
-  unsigned int n_threads = num_pthreads(range);
-
-  std::vector<std::unique_ptr<Range>> ranges(n_threads);
-  std::vector<RangeBody<const Range, const Body>> range_bodies(n_threads);
-  std::vector<pthread_t> threads(n_threads);
+  std::vector<std::unique_ptr<Range>> chunks;
+  split_range(range, libMesh::n_threads(), chunks);
 
-  // Create the ranges for each thread
-  std::size_t range_size = range.size() / n_threads;
+  const unsigned int n_workers = cast_int<unsigned int>
+    (std::min(std::size_t(libMesh::n_threads()), chunks.size()));
 
-  typename Range::const_iterator current_beginning = range.begin();
+  ChunkQueues queues(n_workers, chunks.size());
 
-  for (unsigned int i=0; i<n_threads; i++)
+  run_workers(n_workers, [&](unsigned int worker)
     {
-      std::size_t this_range_size = range_size;
-
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = std::make_unique<Range>(range, current_beginning, current_beginning + this_range_size);
-
-      current_beginning = current_beginning + this_range_size;
-    }
-
-  // Create the RangeBody arguments
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      range_bodies[i].range = ranges[i].get();
-      range_bodies[i].body = &body;
-    }
-
-  // Create the threads.  It may seem redundant to wrap a pragma in
-  // #ifdefs... but GCC warns about an "unknown pragma" if it
-  // encounters this line of code when -fopenmp is not passed to the
-  // compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    pthread_join(threads[i], nullptr);
-#endif
+      std::size_t c;
+      while (queues.next(worker, c))
+        body(*chunks[c]);
+    });
 }
 
 /**
@@ -354,6 +378,10 @@ void parallel_for (const Range & range, const Body & body, const Partitioner &)
 /**
  * Execute the provided reduction operation in parallel on the specified
  * range.
+ *
+ * Each thread accumulates into its own copy of \p body over whichever
+ * chunks it runs, so, unlike with TBB, the subranges a body has seen
+ * need not be contiguous; reductions should be commutative.
  */
 template <typename Range, typename Body>
 inline
@@ -370,80 +398,34 @@ void parallel_reduce (const Range & range, Body & body)
 
   DisablePerfLogInScope disable_perf;
 
-  unsigned int n_threads = num_pthreads(range);
+  std::vector<std::unique_ptr<Range>> chunks;
+  split_range(range, libMesh::n_threads(), chunks);
 
-  std::vector<std::unique_ptr<Range>> ranges(n_threads);
-  std::vector<std::unique_ptr<Body>> managed_bodies(n_threads); // bodies we are responsible for
-  std::vector<Body *> bodies(n_threads); // dumb pointers to managed_bodies
-  std::vector<RangeBody<Range, Body>> range_bodies(n_threads);
+  const unsigned int n_workers = cast_int<unsigned int>
+    (std::min(std::size_t(libMesh::n_threads()), chunks.size()));
 
-  // Create n_threads-1 copies of "body". We manage the lifetime of
+  // Create n_workers-1 copies of "body". We manage the lifetime of
   // these copies with std::unique_ptrs.
-  for (unsigned int i=1; i<n_threads; i++)
-    managed_bodies[i] = std::make_unique<Body>(body, Threads::split());
-
-  // Set up the "bodies" vector. Use the passed in body for the first
-  // one, point to managed_bodies entries for the others.
+  std::vector<std::unique_ptr<Body>> managed_bodies(n_workers);
+  std::vector<Body *> bodies(n_workers);
   bodies[0] = &body;
-  for (unsigned int i=1; i<n_threads; i++)
-    bodies[i] = managed_bodies[i].get();
-
-  // Create the ranges for each thread
-  std::size_t range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
-
-  for (unsigned int i=0; i<n_threads; i++)
+  for (unsigned int i=1; i<n_workers; i++)
     {
-      std::size_t this_range_size = range_size;
-
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = std::make_unique<Range>(range, current_beginning, current_beginning + this_range_size);
-
-      current_beginning = current_beginning + this_range_size;
+      managed_bodies[i] = std::make_unique<Body>(body, Threads::split());
+      bodies[i] = managed_bodies[i].get();
     }
 
-  // Create the RangeBody arguments
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      range_bodies[i].range = ranges[i].get();
-      range_bodies[i].body = bodies[i];
-    }
-
-  // Create the threads
-  std::vector<pthread_t> threads(n_threads);
+  ChunkQueues queues(n_workers, chunks.size());
 
-  // It may seem redundant to wrap a pragma in #ifdefs... but GCC
-  // warns about an "unknown pragma" if it encounters this line of
-  // code when -fopenmp is not passed to the compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
+  const unsigned int n_run = run_workers(n_workers, [&](unsigned int worker)
     {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-  for (unsigned int i=0; i<n_threads; i++)
-    pthread_join(threads[i], nullptr);
-#endif
+      std::size_t c;
+      while (queues.next(worker, c))
+        (*bodies[worker])(*chunks[c]);
+    });
 
   // Join them all down to the original Body
-  for (unsigned int i=n_threads-1; i != 0; i--)
+  for (unsigned int i=n_run-1; i != 0; i--)
     bodies[i-1]->join(*bodies[i]);
 }
 
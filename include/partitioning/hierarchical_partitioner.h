@@ -0,0 +1,136 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_HIERARCHICAL_PARTITIONER_H
+#define LIBMESH_HIERARCHICAL_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/partitioner.h"
+
+// C++ Includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The \p HierarchicalPartitioner partitions in two levels: first
+ * across compute nodes, then across the ranks on each node.  Edges
+ * cut by the first level cost network communication and edges cut
+ * only by the second cost shared memory communication, so
+ * partitioning the two separately keeps the expensive cut as small
+ * as the internal Partitioner can make it, rather than mixing it in
+ * with the cheap one.
+ *
+ * By default the compute nodes are found by splitting the mesh
+ * communicator into shared memory communicators
+ * (MPI_COMM_TYPE_SHARED).  That topology only applies when
+ * partitioning into one part per processor; set_ranks_per_node()
+ * can be used to set a topology for any number of parts instead.
+ * Parts are grouped into nodes in order, so with 4 ranks per node
+ * parts 0-3 share a node, 4-7 share the next, and so on.
+ *
+ * If there is only one node, or if nodes have differing numbers of
+ * ranks, this just uses the internal Partitioner directly.
+ *
+ * \date 2024
+ * \brief Partitions across compute nodes, then across ranks on each node.
+ */
+class HierarchicalPartitioner : public Partitioner
+{
+public:
+
+  /**
+   * Constructors.  The default ctor initializes the internal
+   * Partitioner object to a MetisPartitioner.
+   */
+  HierarchicalPartitioner ();
+  HierarchicalPartitioner (const HierarchicalPartitioner & other);
+
+  /**
+   * This class contains a unique_ptr member, so it can't be default
+   * copy assigned.
+   */
+  HierarchicalPartitioner & operator= (const HierarchicalPartitioner &) = delete;
+
+  /**
+   * Move ctor, move assignment operator, and destructor are
+   * all explicitly defaulted for this class.
+   */
+  HierarchicalPartitioner (HierarchicalPartitioner &&) = default;
+  HierarchicalPartitioner & operator= (HierarchicalPartitioner &&) = default;
+  virtual ~HierarchicalPartitioner() = default;
+
+  virtual PartitionerType type () const override;
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual std::unique_ptr<Partitioner> clone () const override
+  {
+    return std::make_unique<HierarchicalPartitioner>(*this);
+  }
+
+  /**
+   * Groups every \p n consecutive parts onto a compute node, rather
+   * than asking MPI for the topology.  Passing 0 goes back to asking
+   * MPI.
+   */
+  void set_ranks_per_node (unsigned int n) { _ranks_per_node = n; }
+
+  /**
+   * Get a reference to the Partitioner used internally at both
+   * levels.  It must support partition_range(), as e.g. the
+   * MetisPartitioner and the space-filling curve partitioners do.
+   */
+  std::unique_ptr<Partitioner> & internal_partitioner() { return _internal_partitioner; }
+
+protected:
+  /**
+   * The internal Partitioner we use. Public access via the
+   * internal_partitioner() member function.
+   */
+  std::unique_ptr<Partitioner> _internal_partitioner;
+
+  /**
+   * Partition the \p MeshBase into \p n subdomains.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) override;
+
+private:
+
+  /**
+   * \returns The parts on each compute node when partitioning \p
+   * mesh into \p n parts, or an empty vector if we don't know.
+   */
+  std::vector<std::vector<processor_id_type>>
+  node_parts (const MeshBase & mesh,
+              const unsigned int n) const;
+
+  /**
+   * The number of consecutive parts per node, or 0 to ask MPI.
+   */
+  unsigned int _ranks_per_node;
+};
+
+} // namespace libMesh
+
+#endif  // LIBMESH_HIERARCHICAL_PARTITIONER_H
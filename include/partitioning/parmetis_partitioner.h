@@ -83,6 +83,62 @@ public:
     return std::make_unique<ParmetisPartitioner>(*this);
   }
 
+  /**
+   * Weights each element by the value of its extra element integer
+   * \p elem_integer, e.g. the measured costs accumulated by
+   * FEMSystem::assembly_cost_integer, rather than by its number of
+   * nodes.  Values are rescaled to the range [1,1001] relative to
+   * the largest one; invalid values count as zero.  If every value
+   * is zero we fall back on the default weights.
+   *
+   * Pass libMesh::invalid_uint to go back to the default weights.
+   */
+  void set_weight_integer (unsigned int elem_integer)
+  { _weight_integer = elem_integer; }
+
+  /**
+   * \returns The ratio of the largest per-processor sum of the
+   * weight integer over active local elements to the mean such sum,
+   * or 1 if no weight integer is set or every value is zero.
+   *
+   * This must be called on all processors at once.
+   */
+  Real weight_imbalance (const MeshBase & mesh) const;
+
+  /**
+   * Repartitions \p mesh, via partition(), if its weight_imbalance()
+   * exceeds \p threshold.  Any EquationSystems on the mesh will need
+   * a reinit() afterwards.
+   *
+   * This must be called on all processors at once.
+   *
+   * \returns \p true if the mesh was repartitioned.
+   */
+  bool repartition_if_imbalanced (MeshBase & mesh,
+                                  Real threshold);
+
+  /**
+   * Makes later (re)partitions incremental: the current processor
+   * ids are handed to ParMETIS_V3_AdaptiveRepart as the initial
+   * partition, with \p itr as its ratio of inter-processor
+   * communication time to data redistribution time.  Smaller values
+   * of \p itr move fewer elements at the cost of a larger edge cut;
+   * ParMETIS suggests values between 0.001 and 1000000.
+   *
+   * This suits repartitioning a mesh which was partitioned well
+   * before adaptive refinement, not partitioning a new mesh.  It only
+   * applies when partitioning into one part per processor.
+   */
+  void enable_incremental_repartition (Real itr = 1000)
+  { libmesh_assert_greater(itr, 0); _incremental_itr = itr; }
+
+  /**
+   * Goes back to partitioning independently of the current
+   * processor ids, which is the default.
+   */
+  void disable_incremental_repartition ()
+  { _incremental_itr = 0; }
+
 
 protected:
 
@@ -101,6 +157,18 @@ protected:
   virtual void _do_partition (MeshBase & mesh,
                               const unsigned int n) override;
 
+  /**
+   * The extra element integer giving element weights, or
+   * libMesh::invalid_uint for the default weights.
+   */
+  unsigned int _weight_integer;
+
+  /**
+   * The ParMETIS ITR factor for incremental repartitioning, or zero
+   * if repartitioning isn't incremental.
+   */
+  Real _incremental_itr;
+
 #ifdef LIBMESH_HAVE_PARMETIS
   /**
   * Build the graph.
@@ -117,6 +185,13 @@ private:
    */
   void initialize (const MeshBase & mesh, const unsigned int n_sbdmns);
 
+  /**
+   * \returns \p true if partitioning \p mesh into \p n_sbdmns
+   * parts should start from its current partition.
+   */
+  bool incremental (const MeshBase & mesh,
+                    const unsigned int n_sbdmns) const;
+
   /**
    * Pointer to the Parmetis-specific data structures.  Lets us avoid
    * including parmetis.h here.
@@ -24,6 +24,7 @@
 #include "libmesh/libmesh.h"
 #include "libmesh/id_types.h"
 #include "libmesh/mesh_base.h" // for MeshBase::element_iterator
+#include "libmesh/simple_range.h"
 
 // C++ Includes
 #include <cstddef>
@@ -294,12 +295,28 @@ protected:
    */
   std::vector<dof_id_type> _n_active_elem_on_proc;
 
+  /**
+   * \returns The row of the dual graph for local element \p i: the
+   * global indices by pid of the elements connected to it.
+   */
+  SimpleRange<std::vector<dof_id_type>::const_iterator>
+  dual_graph_row (dof_id_type i) const
+  {
+    return as_range(_dual_graph_adjacency.begin() + _dual_graph_offsets[i],
+                    _dual_graph_adjacency.begin() + _dual_graph_offsets[i+1]);
+  }
+
   /**
    * A dual graph corresponds to the mesh, and it is typically used
    * in paritioner. A vertex represents an element, and its neighbors are the
    * element neighbors.
+   *
+   * The graph is stored in compressed sparse row form: the neighbors
+   * of local element \p i are entries \p _dual_graph_offsets[i]
+   * through \p _dual_graph_offsets[i+1]-1 of \p _dual_graph_adjacency.
    */
-  std::vector<std::vector<dof_id_type>> _dual_graph;
+  std::vector<dof_id_type> _dual_graph_offsets;
+  std::vector<dof_id_type> _dual_graph_adjacency;
 
 
   std::vector<Elem *> _local_id_to_elem;
@@ -101,6 +101,17 @@ protected:
 
 private:
 
+  /**
+   * Partitions a range of elements of a distributed mesh along a
+   * Hilbert curve, using the parallel Hilbert key sort of
+   * MeshCommunication::find_global_indices() so no processor needs
+   * to gather every element.
+   */
+  void partition_distributed_range (MeshBase & mesh,
+                                    MeshBase::element_iterator it,
+                                    MeshBase::element_iterator end,
+                                    const unsigned int n);
+
   /**
    * The type of space-filling curve to use.  Hilbert by default.
    */
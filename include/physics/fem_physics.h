@@ -23,12 +23,19 @@
 // Local Includes
 #include "libmesh/libmesh.h" // for libMesh::invalid_uint
 #include "libmesh/diff_physics.h"
+#include "libmesh/fe_base.h"
 
 // C++ includes
+#include <vector>
 
 namespace libMesh
 {
 
+// Forward declarations
+class DGFEMContext;
+class Elem;
+class FEMContext;
+
 /**
  * This class provides a specific system class.  It aims
  * to generalize any system, linear or nonlinear, which
@@ -49,7 +56,9 @@ public:
    * Constructor.
    */
   FEMPhysics () :
-    DifferentiablePhysics()
+    DifferentiablePhysics(),
+    element_batch_size(0),
+    compute_interior_faces(false)
   {}
 
   /**
@@ -90,6 +99,107 @@ public:
    */
   virtual bool mass_residual (bool request_jacobian,
                               DiffContext &) override;
+
+  /**
+   * A batch of elements which share one type, p refinement level and
+   * subdomain, handed to element_time_derivative_batch().
+   */
+  struct ElementBatch
+  {
+    /**
+     * The elements of the batch.
+     */
+    std::vector<const Elem *> elems;
+
+    /**
+     * One context per element, on which pre_fe_reinit() has been
+     * called but not elem_fe_reinit(), so that each element's
+     * residual and Jacobian go into its own context as usual.
+     */
+    std::vector<FEMContext *> contexts;
+
+    /**
+     * The shape data for each variable from
+     * FEGenericBase::reinit_batch(), with the element index varying
+     * fastest, or nullptr for vector-valued variables.  Variables
+     * which share an FE type share one entry.
+     */
+    std::vector<const FEBase::BatchValues *> fe_values;
+
+    /**
+     * The solution coefficients for each variable, element index
+     * fastest: the coefficient of dof \p i of variable \p var on
+     * element \p e is solution[var][i*elems.size() + e].
+     */
+    std::vector<std::vector<Number>> solution;
+  };
+
+  /**
+   * Adds the time derivative contributions on every element of \p
+   * batch to that element's context, as element_time_derivative()
+   * would one element at a time.  The data are laid out so that a
+   * kernel can loop over the elements of the batch innermost, which
+   * compilers can vectorize.
+   *
+   * This is only called by FEMSystem::assembly() if \p
+   * element_batch_size is larger than 1, with a steady time solver
+   * and no mesh motion.  The element_constraint() calls which follow
+   * it get contexts whose interior FE objects have not been
+   * reinitialized.
+   *
+   * Return true only if the Jacobians on every element of the batch
+   * have been computed; otherwise they will be computed numerically,
+   * using element_time_derivative().
+   *
+   * The default implementation calls elem_fe_reinit() and
+   * element_time_derivative() on each context in turn.
+   */
+  virtual bool element_time_derivative_batch (bool request_jacobian,
+                                              const ElementBatch & batch);
+
+  /**
+   * If larger than 1, FEMSystem::assembly() groups each thread's
+   * elements into batches of up to this many elements of the same
+   * type, p level and subdomain, and calls
+   * element_time_derivative_batch() on each batch instead of
+   * element_time_derivative() on each element.
+   *
+   * Defaults to 0, which keeps assembly element by element.
+   */
+  unsigned int element_batch_size;
+
+  /**
+   * Adds the contributions of the face between \p context.get_elem()
+   * and \p context.get_neighbor(), on side \p context.side of the
+   * former, to both elements at once: the residual on the element
+   * goes in get_elem_residual(), the one on the neighbor in
+   * get_neighbor_residual(), and the Jacobian in the four blocks
+   * get_elem_elem_jacobian(), get_elem_neighbor_jacobian(),
+   * get_neighbor_elem_jacobian() and get_neighbor_neighbor_jacobian().
+   * The side and neighbor side FE objects have been reinitialized,
+   * the interior ones have not; an init_context() override can
+   * request the neighbor side FE data it needs by casting its
+   * argument to a DGFEMContext, which it is for these calls.
+   *
+   * This is only called by FEMSystem::assembly() if \p
+   * compute_interior_faces is true, with a steady time solver and no
+   * mesh motion.  Unlike the side_time_derivative() terms under \p
+   * compute_internal_sides, every face is then assembled exactly
+   * once, including its coupling to the neighbor's dofs.  There is
+   * no numerical Jacobian for these terms, so this must return true
+   * whenever \p request_jacobian is.  Only homogeneous constraints
+   * are applied to them.
+   */
+  virtual bool interior_face_time_derivative (bool request_jacobian,
+                                              DGFEMContext &)
+  { return request_jacobian; }
+
+  /**
+   * If true, FEMSystem::assembly() calls
+   * interior_face_time_derivative() once on every face between two
+   * active elements, after its element loop.  Defaults to false.
+   */
+  bool compute_interior_faces;
 };
 
 
@@ -186,6 +186,10 @@ public:
   /**
    * Initializes the data structures for a quadrature rule for an
    * element of type \p type.
+   *
+   * Every rule computed here is kept in a cache shared by all
+   * threads, so later rules of the same class, type, dimension and
+   * order for the same element type and p level are just copied.
    */
   virtual void init (const ElemType type=INVALID_ELEM,
                      unsigned int p_level=0);
@@ -86,6 +86,19 @@ public:
                                          SparseMatrix<Number> & input_matrix,
                                          NumericVector<Number> & input_rhs);
 
+  /**
+   * Solves A*x=b for the matrix \p input_matrix and each of the
+   * right-hand sides \p input_rhs, storing the results in \p
+   * solutions, with LinearSolver::solve_multiple_rhs() so that the
+   * solver can share its setup between them.  The iteration count
+   * and final residual stored afterwards are the largest over all
+   * the solves.
+   */
+  void solve_for_matrix_and_multiple_rhs (LinearSolver<Number> & input_solver,
+                                          SparseMatrix<Number> & input_matrix,
+                                          const std::vector<NumericVector<Number> *> & input_rhs,
+                                          const std::vector<NumericVector<Number> *> & solutions);
+
   /**
    * Set the RBEvaluation object.
    */
@@ -233,6 +246,18 @@ public:
   {this->normalize_rb_bound_in_greedy = normalize_rb_bound_in_greedy_in; }
   bool get_normalize_rb_bound_in_greedy() const { return normalize_rb_bound_in_greedy; }
 
+  /**
+   * Get/set the number of training samples whose error bounds are
+   * evaluated together in compute_max_error_bound(), using
+   * RBEvaluation::compute_error_bounds().  This requires the theta
+   * functions to be pre-evaluated.  The default of zero calls
+   * get_RB_error_bound() for each sample in turn instead, which is
+   * what subclasses with their own error bounds need.
+   */
+  void set_error_bound_batch_size(unsigned int error_bound_batch_size_in)
+  {this->error_bound_batch_size = error_bound_batch_size_in; }
+  unsigned int get_error_bound_batch_size() const { return error_bound_batch_size; }
+
   /**
    * @return true if \p RB_training_type_in is a type of training that
    * requires a serial training set. For example, POD training generally
@@ -961,6 +986,12 @@ private:
    */
   bool normalize_rb_bound_in_greedy;
 
+  /**
+   * The number of training samples per batch in
+   * compute_max_error_bound(), or zero to evaluate them one at a time.
+   */
+  unsigned int error_bound_batch_size;
+
   /**
    * This string indicates the type of training that we will use.
    * Options are:
@@ -331,6 +331,24 @@ private:
    */
   std::pair<Real, unsigned int> compute_max_eim_error();
 
+  /**
+   * Brings _training_eim_residuals up to date with the EIM
+   * coefficients \p coeffs of each of the \p training_functions,
+   * where \p get_basis(i) returns basis function \p i in the same
+   * format, and returns the largest (scaled) absolute value of each
+   * residual on this processor.
+   */
+  template <class DataMap, class BasisGetter>
+  std::vector<Real> update_training_eim_residuals(const std::vector<DataMap> & training_functions,
+                                                  const std::vector<DenseVector<Number>> & coeffs,
+                                                  const BasisGetter & get_basis);
+
+  /**
+   * Discards the cached training set residuals, so they'll be
+   * recomputed from scratch when next needed.
+   */
+  void clear_training_eim_residuals();
+
   /**
    * Compute and store the parametrized function for each
    * parameter in the training set at all the stored qp locations.
@@ -535,6 +553,25 @@ private:
    */
   std::vector<Real> _component_scaling_in_training_set;
 
+  /**
+   * The EIM residual of each training function as of the last
+   * compute_max_eim_error() with EIM best fit, flattened in map order
+   * into contiguous storage, along with the EIM coefficients it was
+   * computed with and the component scaling of each entry.  Since the
+   * interpolation matrix is lower triangular, adding a basis function
+   * leaves the older coefficients as they were, and each residual
+   * just takes a rank-one update for the new one.
+   */
+  std::vector<std::vector<Number>> _training_eim_residuals;
+  std::vector<DenseVector<Number>> _training_eim_residual_coeffs;
+  std::vector<Real> _training_eim_residual_scaling;
+
+  /**
+   * The EIM basis functions, flattened in the same order as
+   * _training_eim_residuals.
+   */
+  std::vector<std::vector<Number>> _flat_eim_basis_functions;
+
   /**
    * The quadrature point locations, quadrature point weights (JxW), and subdomain IDs
    * on every element local to this processor.
@@ -665,6 +665,14 @@ protected:
 
 private:
 
+  /**
+   * Overwrites the first \p N rows of \p rhs, each column of which
+   * holds the parametrized function at the interpolation points for
+   * one solve, with the EIM coefficients for that solve.
+   */
+  void interpolation_solves(unsigned int N,
+                            DenseMatrix<Number> & rhs) const;
+
   /**
    * Method that writes out element interior EIM basis functions. This may be called by
    * write_out_basis_functions().
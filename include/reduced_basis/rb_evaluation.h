@@ -169,6 +169,56 @@ public:
    */
   Real eval_output_dual_norm(unsigned int n, const std::vector<Number> * evaluated_thetas);
 
+  /**
+   * Computes the error bound rb_solve(N, &evaluated_thetas[s]) would
+   * return for every sample \p s, without touching \p RB_solution or
+   * the RB outputs, and optionally the corresponding
+   * get_error_bound_normalization() values.  \p scaling_denoms[s]
+   * is residual_scaling_denom(get_stability_lower_bound()) for
+   * sample \p s, which the caller has to evaluate since it may depend
+   * on the parameters.
+   *
+   * The samples are processed \p batch_size at a time.  Their
+   * reduced operators are assembled together, as a product of the
+   * theta values with the affine terms, and the small solves are
+   * split over threads.  The residual dual norms are the diagonal of
+   * \f$ C G C^H \f$, where \f$ G \f$ holds all the representor
+   * inner products and each row of \f$ C \f$ the coefficients of one
+   * sample's residual, so they too come down to one dense
+   * matrix-matrix product per batch.
+   *
+   * This follows the steady rb_solve() of this class, so subclasses
+   * which change how the error bound is computed shouldn't use it.
+   */
+  void compute_error_bounds(unsigned int N,
+                            const std::vector<std::vector<Number>> & evaluated_thetas,
+                            const std::vector<Real> & scaling_denoms,
+                            unsigned int batch_size,
+                            std::vector<Real> & error_bounds,
+                            std::vector<Real> * normalizations = nullptr);
+
+  /**
+   * Performs rb_solve(N) for each of the parameters \p mus, leaving
+   * the current parameters, \p RB_solution and the RB outputs alone.
+   * \p outputs[s][n] and \p output_error_bounds[s][n] get output
+   * \p n and its error bound for sample \p s, and \p error_bounds[s]
+   * its absolute error bound; the bounds are -1 if
+   * \p evaluate_RB_error_bound is false.
+   *
+   * The theta functions are evaluated for all the samples at once,
+   * with the vectorized RBThetaExpansion interface, and the samples
+   * are then solved \p batch_size at a time as in
+   * compute_error_bounds(), with their outputs found by one more
+   * matrix-matrix product.  Like that function, this follows the
+   * steady rb_solve() of this class.
+   */
+  void rb_solve_batch(unsigned int N,
+                      const std::vector<RBParameters> & mus,
+                      std::vector<std::vector<Number>> & outputs,
+                      std::vector<Real> & error_bounds,
+                      std::vector<std::vector<Real>> & output_error_bounds,
+                      unsigned int batch_size = 256);
+
   /**
    * Get a lower bound for the stability constant (e.g. coercivity constant or
    * inf-sup constant) at the current parameter value.
@@ -385,6 +435,39 @@ private:
    * that, when provided, it is the right size.
    */
   void check_evaluated_thetas_size(const std::vector<Number> * evaluated_thetas) const;
+
+  /**
+   * Fills \p gram with the inner products of all the residual
+   * representors for the first \p N basis functions: the Fq
+   * representors, then the Aq representors of each basis function,
+   * term by term.
+   */
+  void build_residual_gram_matrix(unsigned int N,
+                                  DenseMatrix<Number> & gram) const;
+
+  /**
+   * Solves the reduced systems for samples \p begin through \p end-1
+   * of \p evaluated_thetas, storing each RB solution as a row of
+   * \p solutions.
+   */
+  void solve_batch(unsigned int N,
+                   const std::vector<std::vector<Number>> & evaluated_thetas,
+                   std::size_t begin,
+                   std::size_t end,
+                   DenseMatrix<Number> & solutions) const;
+
+  /**
+   * Computes the residual dual norm for each row of \p solutions,
+   * the RB solutions for samples starting at \p begin, and, if \p
+   * F_norms is non-null, that of the F terms alone.
+   */
+  void batch_residual_dual_norms(unsigned int N,
+                                 const std::vector<std::vector<Number>> & evaluated_thetas,
+                                 std::size_t begin,
+                                 const DenseMatrix<Number> & solutions,
+                                 const DenseMatrix<Number> & gram,
+                                 std::vector<Real> & residual_norms,
+                                 std::vector<Real> * F_norms) const;
 };
 
 }
@@ -36,6 +36,7 @@ namespace libMesh
 class RBParameters;
 class Point;
 class System;
+template <typename T> class DenseMatrix;
 
 /**
  * Define a struct for the input to the "vectorized evaluate" functions below.
@@ -230,6 +231,24 @@ public:
                                         const VectorizedEvalInput & v,
                                         std::vector<std::vector<std::vector<Number>>> & output);
 
+  /**
+   * Evaluates component \p comps[i] at point \p i of \p v for every
+   * sample in \p mus, and writes the value for sample \p s into
+   * \p values(i,s).  \p values must already be sized comps.size() by
+   * the total number of samples in \p mus, and \p v may have more
+   * points than there are \p comps.
+   *
+   * The base class implementation calls vectorized_evaluate(),
+   * side_vectorized_evaluate() or node_vectorized_evaluate(), as
+   * appropriate, and copies out the requested components.  Derived
+   * classes which can write single components straight into flat
+   * storage may override it to avoid the nested vectors.
+   */
+  virtual void vectorized_evaluate_comps(const std::vector<RBParameters> & mus,
+                                         const VectorizedEvalInput & v,
+                                         const std::vector<unsigned int> & comps,
+                                         DenseMatrix<Number> & values);
+
   /**
    * Store the result of vectorized_evaluate. This is helpful during EIM training,
    * since we can pre-evaluate and store the parameterized function for each training
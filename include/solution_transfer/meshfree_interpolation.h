@@ -24,6 +24,7 @@
 #include "libmesh/libmesh_config.h"
 #include "libmesh/libmesh_common.h"
 #include "libmesh/point.h"
+#include "libmesh/bounding_box.h"
 #include "libmesh/parallel_object.h"
 #ifdef LIBMESH_HAVE_NANOFLANN
 #  include "libmesh/ignore_warnings.h"
@@ -66,19 +67,45 @@ public:
    * from other processors, so all interpolation can be performed
    * locally.
    *
+   * SYNC_OVERLAPPING_SOURCES only copies to each processor those
+   * remote source points which lie within the search radius of its
+   * target region, see \p set_target_region().  This keeps the memory
+   * per processor proportional to the local problem, at the cost of
+   * interpolating targets near the edge of the region from only the
+   * source points within the radius.
+   *
    * Other \p ParallelizationStrategy techniques will be implemented
    * as needed.
    */
   enum ParallelizationStrategy {SYNC_SOURCES     = 0,
+                                SYNC_OVERLAPPING_SOURCES,
                                 INVALID_STRATEGY};
   /**
    * Constructor.
    */
   MeshfreeInterpolation (const libMesh::Parallel::Communicator & comm_in) :
     ParallelObject(comm_in),
-    _parallelization_strategy (SYNC_SOURCES)
+    _parallelization_strategy (SYNC_SOURCES),
+    _search_radius (0.),
+    _have_target_region (false)
   {}
 
+  /**
+   * Sets the \p ParallelizationStrategy used by \p prepare_for_use().
+   */
+  void set_parallelization_strategy (ParallelizationStrategy strategy)
+  { _parallelization_strategy = strategy; }
+
+  /**
+   * Declares that the target points on this processor all lie within
+   * \p tgt_box, e.g. as given by MeshTools::create_local_bounding_box(),
+   * and that source points within \p search_radius of it are enough
+   * to interpolate them.  This must be called on every processor
+   * before \p prepare_for_use() with SYNC_OVERLAPPING_SOURCES.
+   */
+  void set_target_region (const BoundingBox & tgt_box,
+                          Real search_radius);
+
   /**
    * Prints information about this object, by default to
    * libMesh::out.
@@ -164,16 +191,41 @@ protected:
    */
   virtual void gather_remote_data ();
 
+  /**
+   * Gathers the source points and values, added on other processors,
+   * which lie within the search radius of the target region on this
+   * processor.  Each processor only sends its points to those
+   * processors whose regions contain them.
+   */
+  virtual void gather_overlapping_data ();
+
   ParallelizationStrategy  _parallelization_strategy;
   std::vector<std::string> _names;
   std::vector<Point>       _src_pts;
   std::vector<Number>      _src_vals;
+
+  /**
+   * The region containing the target points on this processor, and
+   * how far beyond it source points are needed.
+   */
+  BoundingBox              _tgt_box;
+  Real                     _search_radius;
+  bool                     _have_target_region;
 };
 
 
 
 /**
  * Inverse distance interpolation.
+ *
+ * The KD tree over the source points is built on first use and kept
+ * until clear(), so the source values may be overwritten in place,
+ * via get_source_vals(), for each of a series of transfers between
+ * fixed geometries.  Target points are searched in parallel using
+ * libMesh threads.  With set_cache_target_weights(), the neighbors
+ * and weights found for a set of target points are also kept, and
+ * interpolating to the same points again is just a sparse
+ * matrix-vector product.
  */
 template <unsigned int KDDim>
 class InverseDistanceInterpolation : public MeshfreeInterpolation
@@ -314,15 +366,40 @@ protected:
                             const std::vector<Real>   & src_dist_sqr,
                             std::vector<Number>::iterator & out_it) const;
 
+  /**
+   * Computes the normalized weight of each source point at the
+   * squared distances \p src_dist_sqr into \p weights.
+   *
+   * \returns The normalized weight of the background value.
+   */
+  Real compute_weights (const std::vector<Real> & src_dist_sqr,
+                        std::vector<Real>       & weights) const;
+
+  /**
+   * Forgets any cached target points, neighbors and weights.
+   */
+  void clear_target_weights () const;
+
   const Real         _half_power;
   const unsigned int _n_interp_pts;
   const Number       _background_value;
   const Real         _background_eff_dist;
 
   /**
-   * Temporary work array.  Object level scope to avoid cache thrashing.
+   * Whether to keep the neighbors and weights of the last target
+   * points between calls to interpolate_field_data().
    */
-  mutable std::vector<Number> _vals;
+  bool _cache_target_weights;
+
+  /**
+   * The last target points, the indices and normalized weights of
+   * the source points each is interpolated from (with a fixed number
+   * per target point), and the normalized background weight of each.
+   */
+  mutable std::vector<Point>       _cached_tgt_pts;
+  mutable std::vector<std::size_t> _cached_src_indices;
+  mutable std::vector<Real>        _cached_weights;
+  mutable std::vector<Real>        _cached_background_weights;
 
 public:
 
@@ -350,7 +427,8 @@ public:
     _half_power(power/2.0),
     _n_interp_pts(n_interp_pts),
     _background_value(background_value),
-    _background_eff_dist(background_eff_dist)
+    _background_eff_dist(background_eff_dist),
+    _cache_target_weights(false)
   {}
 
   /**
@@ -359,6 +437,15 @@ public:
    */
   virtual void clear() override;
 
+  /**
+   * Enables or disables caching of the neighbors and weights found
+   * for the target points in interpolate_field_data().  While it is
+   * enabled, repeated calls with the same target points skip the
+   * KD tree searches, and only the source values may change between
+   * them.  The cache is discarded when the source points change.
+   */
+  void set_cache_target_weights (bool cache);
+
   /**
    * Interpolate source data at target points.
    * Pure virtual, must be overridden in derived classes.
@@ -20,11 +20,17 @@
 
 #include "libmesh/solution_transfer.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace libMesh
 {
 
+// Forward declarations
+class System;
+template <typename T> class SparseMatrix;
+
 /**
  * Implementation of a SolutionTransfer object that only works for
  * transferring the solution using a MeshFunction
@@ -32,6 +38,11 @@ namespace libMesh
  * \note A serialization of the "from" solution vector will be
  * performed!  This can be slow in parallel and take a lot of memory!
  *
+ * When the meshes don't change between transfers, \p setup() can
+ * instead record the transfer as a distributed sparse matrix, after
+ * which each \p transfer() between the same variables is a single
+ * parallel matrix-vector product with no serialization.
+ *
  * \author Derek Gaston
  * \date 2013
  * \brief SolutionTransfer object which uses a MeshFunction.
@@ -46,6 +57,38 @@ public:
    * Transfer the values of a variable to another.
    */
   virtual void transfer(const Variable & from_var, const Variable & to_var) override;
+
+  /**
+   * Precomputes the transfer from \p from_var to \p to_var: the
+   * source element containing each local target node is located and
+   * its shape function values there are stored as one row of a
+   * sparse matrix.  Subsequent transfers between these variables
+   * apply that matrix, until setup() is called again, which it must
+   * be if either mesh or DofMap changes.
+   */
+  void setup(const Variable & from_var, const Variable & to_var);
+
+  /**
+   * Discards any transfer matrix built by setup().
+   */
+  void clear_setup();
+
+private:
+
+  /**
+   * The transfer matrix from the "from" system dofs to the "to"
+   * system dofs, and which variables it was built for.
+   */
+  std::unique_ptr<SparseMatrix<Number>> _transfer_matrix;
+  const System * _from_sys;
+  const System * _to_sys;
+  unsigned int _from_var_num;
+  unsigned int _to_var_num;
+
+  /**
+   * The local "to" system dofs which _transfer_matrix sets.
+   */
+  std::vector<dof_id_type> _to_dofs;
 };
 
 } // namespace libMesh
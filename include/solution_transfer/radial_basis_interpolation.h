@@ -35,6 +35,14 @@ namespace libMesh
 /**
  * Radial Basis Function interpolation.
  *
+ * When the RBF support radius given to the constructor is smaller
+ * than the diagonal of the source bounding box, and nanoflann is
+ * available, the interpolation system is assembled sparsely from KD
+ * tree radius searches and factored with a sparse Cholesky
+ * decomposition, and each target point only visits the source points
+ * within its support.  Otherwise the dense system covering every pair
+ * of source points is solved.
+ *
  * \author Benjamin S. Kirk
  * \date 2013
  * \brief Does radial basis function interpolation using Nanoflann.
@@ -71,6 +79,12 @@ protected:
    */
   Real _r_override;
 
+  /**
+   * \returns \p true if the RBF support radius is small enough, relative
+   * to the source points, that they don't all overlap.
+   */
+  bool compact_support() const;
+
 public:
 
   /**
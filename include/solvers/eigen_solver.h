@@ -104,6 +104,36 @@ public:
     _close_matrix_before_solve = val;
   }
 
+  /**
+   * \returns The value of the flag which controls whether the solver
+   * keeps its internal data between solves.  \p false by default.
+   */
+  bool get_reuse_solver() const { return _reuse_solver; }
+
+  /**
+   * Set the flag which controls whether the solver keeps its internal
+   * data between solves, rather than setting up from scratch each
+   * time.  If the operators are the same matrix objects from one
+   * solve to the next, as in a sweep over a shift or other parameter,
+   * a spectral transformation can then reuse its factorization
+   * structure.
+   */
+  void set_reuse_solver(bool val) { _reuse_solver = val; }
+
+  /**
+   * \returns The value of the flag which controls whether each solve
+   * starts from the eigenvectors found by the previous one.  \p false
+   * by default.
+   */
+  bool get_warm_start() const { return _warm_start; }
+
+  /**
+   * Set the flag which controls whether each solve starts from the
+   * eigenvectors found by the previous one.  An initial space given
+   * by \p set_initial_space() takes precedence.
+   */
+  void set_warm_start(bool val) { _warm_start = val; }
+
   /**
    * Release all memory and clear data structures.
    */
@@ -350,6 +380,17 @@ protected:
   Real _target_val;
 
   bool _close_matrix_before_solve;
+
+  /**
+   * Flag indicating whether to keep the solver data between solves.
+   */
+  bool _reuse_solver;
+
+  /**
+   * Flag indicating whether to start each solve from the previously
+   * converged eigenvectors.
+   */
+  bool _warm_start;
 };
 
 } // namespace libMesh
@@ -0,0 +1,196 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_EXPLICIT_RUNGE_KUTTA_SOLVER_H
+#define LIBMESH_EXPLICIT_RUNGE_KUTTA_SOLVER_H
+
+// Local includes
+#include "libmesh/first_order_unsteady_solver.h"
+
+// C++ includes
+#include <memory>
+
+namespace libMesh
+{
+
+/**
+ * This class defines an explicit, strong stability preserving
+ * Runge-Kutta solver to handle time integration of
+ * DifferentiableSystems without any linear or nonlinear solves.
+ *
+ * The mass matrix given by the DifferentiablePhysics'
+ * mass_residual() is lumped by row sums, so every stage is a
+ * forward Euler step \f$ u \leftarrow u + \Delta t M_L^{-1} F(u) \f$
+ * costing one residual assembly and a pointwise product.  The
+ * stages are combined in the Shu-Osher form, giving forward Euler,
+ * Heun's method or the three stage SSP-RK3 scheme for \p order 1, 2
+ * or 3.
+ *
+ * Row sum lumping assumes that a unit time derivative on every
+ * degree of freedom is a unit time derivative everywhere, as it is
+ * for nodal (e.g. LAGRANGE) bases.  Constrained degrees of freedom
+ * are set from the constraint equations after each stage, and
+ * algebraic constraint terms and second order variables are not
+ * supported; use an implicit solver for those.
+ *
+ * By default the lumped mass is assembled once, on the first solve
+ * and after each reinit(); set \p lumped_mass_is_constant to \p false
+ * if the mass depends on the solution.
+ *
+ * \date 2024
+ * \brief Explicit SSP Runge-Kutta time solver with a lumped mass.
+ */
+class ExplicitRungeKuttaSolver : public FirstOrderUnsteadySolver
+{
+public:
+  /**
+   * The parent class
+   */
+  typedef FirstOrderUnsteadySolver Parent;
+
+  /**
+   * Constructor. Requires a reference to the system
+   * to be solved.
+   */
+  explicit
+  ExplicitRungeKuttaSolver (sys_type & s);
+
+  /**
+   * Destructor.
+   */
+  virtual ~ExplicitRungeKuttaSolver ();
+
+  /**
+   * The lumped mass depends on the mesh and the dof numbering, so
+   * it is discarded here.
+   */
+  virtual void reinit () override;
+
+  /**
+   * Advances the solution by one timestep of size deltat.
+   */
+  virtual void solve () override;
+
+  /**
+   * Error convergence order: \p order.
+   */
+  virtual Real error_order() const override;
+
+  /**
+   * This method uses the DifferentiablePhysics'
+   * element_time_derivative() to build the stage residual on an
+   * element, or mass_residual() with a unit solution rate to build
+   * the lumped mass.
+   */
+  virtual bool element_residual (bool request_jacobian,
+                                 DiffContext &) override;
+
+  /**
+   * This method uses the DifferentiablePhysics'
+   * side_time_derivative() or side_mass_residual() on an element's
+   * side.
+   */
+  virtual bool side_residual (bool request_jacobian,
+                              DiffContext &) override;
+
+  /**
+   * This method uses the DifferentiablePhysics'
+   * nonlocal_time_derivative() or nonlocal_mass_residual() for
+   * non-local terms.
+   */
+  virtual bool nonlocal_residual (bool request_jacobian,
+                                  DiffContext &) override;
+
+  /**
+   * Adjoints of the explicit scheme are not yet supported.
+   */
+  virtual std::pair<unsigned int, Real> adjoint_solve (const QoISet & qoi_indices) override;
+
+  virtual void integrate_qoi_timestep() override;
+
+#ifdef LIBMESH_ENABLE_AMR
+  virtual void integrate_adjoint_refinement_error_estimate(AdjointRefinementEstimator & adjoint_refinement_error_estimator, ErrorVector & QoI_elementwise_error) override;
+#endif // LIBMESH_ENABLE_AMR
+
+  /**
+   * The order of the scheme: 1 for forward Euler, 2 for Heun's
+   * method, 3 (the default) for SSP-RK3.
+   */
+  unsigned int order;
+
+  /**
+   * Set to \p false to reassemble the lumped mass on every step.
+   * Defaults to \p true.
+   */
+  bool lumped_mass_is_constant;
+
+protected:
+
+  /**
+   * Assembles the row sum lumped mass and stores its reciprocal in
+   * \p _inverse_lumped_mass.
+   */
+  void compute_inverse_lumped_mass ();
+
+  /**
+   * Replaces the system solution \p u with
+   * \f$ u + \Delta t M_L^{-1} F(u) \f$, with \f$ F \f$ evaluated at
+   * \f$ t + c \Delta t \f$.
+   */
+  void forward_euler_stage (Real c);
+
+  /**
+   * This method is the underlying implementation of the public
+   * residual methods.
+   */
+  virtual bool _general_residual (bool request_jacobian,
+                                  DiffContext &,
+                                  ResFuncType mass,
+                                  ResFuncType time_deriv,
+                                  ReinitFuncType reinit);
+
+  /**
+   * The reciprocal of the lumped mass, or nullptr until it has been
+   * assembled.
+   */
+  std::unique_ptr<NumericVector<Number>> _inverse_lumped_mass;
+
+  /**
+   * Scratch space for the stage rates.
+   */
+  std::unique_ptr<NumericVector<Number>> _rate;
+
+  /**
+   * Whether the residual methods are currently assembling the
+   * lumped mass rather than a stage residual.
+   */
+  bool _assembling_mass;
+
+  /**
+   * The fraction of the timestep at which the current stage residual
+   * is evaluated.
+   */
+  Real _stage_time;
+};
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_EXPLICIT_RUNGE_KUTTA_SOLVER_H
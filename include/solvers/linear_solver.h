@@ -143,6 +143,25 @@ public:
    */
   bool get_same_preconditioner();
 
+  /**
+   * Reuse the preconditioner adaptively: once it has been built, keep
+   * it for subsequent solves, even if the matrix has changed, until a
+   * solve takes more than \p growth_factor times as many iterations
+   * as the first solve with it did, then rebuild it for the next
+   * solve.  Transient runs with slowly varying matrices then skip
+   * most preconditioner setups.
+   *
+   * \p growth_factor == 0, the default, disables adaptive reuse; the
+   * reuse_preconditioner() flag, if set, still reuses it always.
+   */
+  void set_preconditioner_reuse_factor (Real growth_factor);
+
+  /**
+   * \returns The factor set by set_preconditioner_reuse_factor().
+   */
+  Real get_preconditioner_reuse_factor() const
+  { return _preconditioner_reuse_factor; }
+
   /**
    * After calling this method, all successive solves will be
    * restricted to the given set of dofs, which must contain local
@@ -206,6 +225,38 @@ public:
 
 
 
+  /**
+   * Solves the system with \p matrix for each of the right-hand
+   * sides \p rhs in turn, putting the results in the corresponding
+   * entries of \p solutions.  The preconditioner is set up for the
+   * first solve and reused for the rest; subclasses may instead
+   * solve all of them as one block, reusing a factorization.
+   *
+   * \returns The number of iterations and the final residual for
+   * each right-hand side.
+   */
+  virtual std::vector<std::pair<unsigned int, Real>>
+  solve_multiple_rhs (SparseMatrix<T> & matrix,
+                      const std::vector<NumericVector<T> *> & solutions,
+                      const std::vector<NumericVector<T> *> & rhs,
+                      const std::optional<double> tol = std::nullopt,
+                      const std::optional<unsigned int> m_its = std::nullopt);
+
+  /**
+   * Solves the adjoint system with \p matrix for each of the
+   * right-hand sides \p rhs, as solve_multiple_rhs() does for the
+   * forward system.
+   *
+   * \returns The number of iterations and the final residual for
+   * each right-hand side.
+   */
+  virtual std::vector<std::pair<unsigned int, Real>>
+  adjoint_solve_multiple_rhs (SparseMatrix<T> & matrix,
+                              const std::vector<NumericVector<T> *> & solutions,
+                              const std::vector<NumericVector<T> *> & rhs,
+                              const std::optional<double> tol = std::nullopt,
+                              const std::optional<unsigned int> m_its = std::nullopt);
+
   /**
    * This function solves a system whose matrix is a shell matrix.
    */
@@ -288,6 +339,40 @@ protected:
    */
   bool same_preconditioner;
 
+  /**
+   * \returns \p true if the next solve should reuse the current
+   * preconditioner, by the reuse_preconditioner() flag or the
+   * adaptive policy.
+   */
+  bool reuse_preconditioner_now () const;
+
+  /**
+   * Updates the adaptive reuse policy after a solve which took \p
+   * its iterations, with a preconditioner which was reused if \p
+   * reused is true and newly built otherwise.
+   */
+  void record_preconditioner_iterations (unsigned int its, bool reused);
+
+  /**
+   * Forgets the preconditioner the adaptive policy was reusing, so
+   * the next solve rebuilds it.
+   */
+  void reset_preconditioner_reuse ()
+  { _preconditioner_reference_its = libMesh::invalid_uint; }
+
+  /**
+   * The growth in iterations that triggers a preconditioner rebuild,
+   * or 0 to disable adaptive reuse.
+   */
+  Real _preconditioner_reuse_factor;
+
+  /**
+   * The iterations taken by the first solve with the current
+   * preconditioner, or \p invalid_uint if the next solve needs a new
+   * one.
+   */
+  unsigned int _preconditioner_reference_its;
+
   /**
    * Optionally store a SolverOptions object that can be used
    * to set parameters like solver type, tolerances and iteration limits.
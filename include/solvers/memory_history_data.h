@@ -7,6 +7,12 @@
 
 #include "libmesh/numeric_vector.h"
 
+// C++ includes
+#include <future>
+#include <map>
+#include <string>
+#include <vector>
+
 namespace libMesh
 {
     /** MemoryHistoryData provides a data structure to store memory history data.
@@ -18,10 +24,11 @@ namespace libMesh
         public:
 
         // Constructor
-        MemoryHistoryData(DifferentiableSystem & system) : HistoryData(), _system(system), stored_vecs{}, stored_vec(stored_vecs.end()) {};
+        // If compress is true, vectors are kept in single precision.
+        MemoryHistoryData(DifferentiableSystem & system, bool compress = false) : HistoryData(), _system(system), stored_vecs{}, stored_vec(stored_vecs.end()), _compress(compress) {};
 
         // Destructor
-        ~MemoryHistoryData() {};
+        ~MemoryHistoryData() { remove_spill_file(); };
 
         virtual void store_initial_solution() override;
         virtual void store_primal_solution(stored_data_iterator stored_datum) override;
@@ -34,8 +41,34 @@ namespace libMesh
         void store_vectors();
         void retrieve_vectors();
 
+        // Moves the stored vectors out of memory, writing the local
+        // entries on this processor to the file spill_filename, from
+        // which retrieve_vectors() will read them back.
+        void spill_vectors(const std::string & spill_filename);
+
+        // Starts reading spilled vectors back in, in the background
+        // when threads are available, for the next retrieve_vectors().
+        void prefetch_vectors();
+
+        // Whether our vectors are in memory rather than spilled.
+        bool in_memory() const
+        { return _spill_filename.empty(); }
+
         private:
 
+        // The local entries of each spilled vector, by name
+        typedef std::map<std::string, std::vector<Number>> local_values_type;
+
+        static local_values_type read_spilled_vectors(const std::string & spill_filename,
+                                                      bool compressed);
+
+        void store_vector(const std::string & vec_name,
+                          const NumericVector<Number> & vec);
+
+        void install_local_values(const local_values_type & local_values);
+
+        void remove_spill_file();
+
         DifferentiableSystem & _system;
 
         typedef std::map<std::string, std::unique_ptr<NumericVector<Number>>> map_type;
@@ -46,6 +79,17 @@ namespace libMesh
         map_type stored_vecs;
         stored_vecs_iterator stored_vec;
 
+        // Whether to keep our vectors in single precision, and the
+        // local entries of each when we do
+        bool _compress;
+        std::map<std::string, std::vector<float>> compressed_vecs;
+
+        // Where our vectors were spilled, if they were
+        std::string _spill_filename;
+
+        // Vectors being read back in by prefetch_vectors()
+        std::future<local_values_type> _prefetched;
+
     };
 
 }
@@ -48,7 +48,9 @@ public:
    * Constructor, reference to system to be passed by user, set the
    * stored_sols iterator to some initial value
    */
-  MemorySolutionHistory(DifferentiableSystem & system_) : SolutionHistory(), _system(system_)
+  MemorySolutionHistory(DifferentiableSystem & system_) : SolutionHistory(), _system(system_),
+    _max_in_memory(0),
+    _compress(false)
   { libmesh_experimental(); }
 
   /**
@@ -73,13 +75,50 @@ public:
    */
   virtual std::unique_ptr<SolutionHistory > clone() const override
   {
-    return std::make_unique<MemorySolutionHistory>(_system);
+    auto history = std::make_unique<MemorySolutionHistory>(_system);
+    history->set_max_in_memory(_max_in_memory, _spill_prefix);
+    history->set_compression(_compress);
+    return history;
   }
 
+  /**
+   * Keeps the vectors of at most \p n timesteps in memory, or of
+   * every timestep if \p n is zero, the default.  The vectors of the
+   * oldest timesteps beyond that are spilled to files named
+   * \p spill_prefix.<timestep>.<processor>, and read back when they
+   * are retrieved.  During an adjoint sweep, the previous timestep
+   * is prefetched from its file while the current one is solved.
+   */
+  void set_max_in_memory(unsigned int n,
+                         const std::string & spill_prefix = "memory_history")
+  { _max_in_memory = n; _spill_prefix = spill_prefix; }
+
+  /**
+   * If \p compress is true, timesteps stored from now on keep their
+   * vectors rounded to single precision, halving their memory (and
+   * spill file) footprint at the cost of a relative error of about
+   * 1e-7 in each entry when they are retrieved.
+   */
+  void set_compression(bool compress)
+  { _compress = compress; }
+
 private:
 
+  /**
+   * Spills the oldest timesteps other than the current one until at
+   * most _max_in_memory are left in memory.
+   */
+  void enforce_memory_limit();
+
   // A system reference
   DifferentiableSystem & _system ;
+
+  // How many timesteps to keep in memory, and where to spill others
+  unsigned int _max_in_memory;
+  std::string _spill_prefix;
+
+  // Whether new timesteps are stored in single precision
+  bool _compress;
 };
 
 } // end namespace libMesh
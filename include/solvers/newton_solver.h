@@ -142,6 +142,38 @@ public:
    */
   double linear_tolerance_multiplier;
 
+  /**
+   * The Jacobian is only reassembled every \p jacobian_lag Newton
+   * steps; the steps in between assemble just the residual and
+   * reuse the last Jacobian, and with it any preconditioner built
+   * from it.  It defaults to 1, reassembling at every step.
+   */
+  unsigned int jacobian_lag;
+
+  /**
+   * When \p jacobian_lag > 1, a lagged Jacobian is also
+   * reassembled early after any step which fails to reduce the
+   * residual below this fraction of what it was.  It defaults to
+   * 0.5.
+   */
+  Real jacobian_stall_ratio;
+
+  /**
+   * If true, the linear tolerance at each step is chosen by the
+   * second forcing term of Eisenstat and Walker,
+   * \f$ \eta_k = \gamma (|r_k| / |r_{k-1}|)^\alpha \f$, safeguarded
+   * against decreasing too quickly, instead of by \p
+   * linear_tolerance_multiplier.  It is false by default.
+   */
+  bool use_eisenstat_walker;
+
+  /**
+   * The \f$ \gamma \f$ and \f$ \alpha \f$ of the Eisenstat-Walker
+   * forcing term, defaulting to 0.9 and 2.
+   */
+  Real eisenstat_walker_gamma;
+  Real eisenstat_walker_alpha;
+
 protected:
 
   /**
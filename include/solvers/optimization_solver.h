@@ -194,6 +194,30 @@ public:
    */
   bool verbose;
 
+  /**
+   * If true, \p solve() starts from the current solution of the
+   * system, e.g. the optimum of a previous similar problem, instead
+   * of from zero.  Defaults to false.
+   */
+  bool warm_start;
+
+  /**
+   * If true, the Jacobians of the equality and inequality constraints
+   * are taken to be independent of X, as they are for linear
+   * constraints, so solvers which support it assemble them only once
+   * and reuse them until the solver is cleared, e.g. by
+   * OptimizationSystem::reinit().  Defaults to false.
+   */
+  bool constant_constraints_jacobians;
+
+  /**
+   * If true, solvers which support it use a limited-memory
+   * quasi-Newton (L-BFGS) approximation of the Hessian, built from
+   * the gradients, and never call \p hessian_object.  This avoids all
+   * Hessian assembly when that dominates the cost.  Defaults to false.
+   */
+  bool hessian_approximation;
+
 protected:
 
   /**
@@ -0,0 +1,150 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PARAREAL_SOLVER_H
+#define LIBMESH_PARAREAL_SOLVER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class DifferentiableSystem;
+class UnsteadySolver;
+
+/**
+ * This class drives the Parareal parallel-in-time iteration over a
+ * DifferentiableSystem.
+ *
+ * The processors are split into groups, each holding its own copy of
+ * the mesh and system on its own communicator, and every group is
+ * given one slice of the time interval.  The system's own time solver
+ * is the fine propagator; a cheaper UnsteadySolver for the same
+ * system, typically an EulerSolver run with a larger timestep, is the
+ * coarse propagator.  Each iteration runs the fine propagator on every
+ * slice at once, then corrects the slice start values with a
+ * pipelined coarse sweep,
+ * \f$ U_{k+1}^{j+1} = G(U_k^{j+1}) + F(U_k^j) - G(U_k^j) \f$.
+ * After \p j iterations the first \p j slices match a serial fine
+ * solve exactly.
+ *
+ * The time communicator given to the constructor must connect the
+ * processors with the same rank in every group, and every group must
+ * build an identical mesh and system, so that each processor owns the
+ * same degrees of freedom as its counterparts.  Splitting a world
+ * communicator twice, by group and by rank within the group, gives
+ * both communicators.
+ *
+ * \date 2024
+ * \brief Parareal parallel-in-time driver.
+ */
+class PararealSolver : public ParallelObject
+{
+public:
+  /**
+   * Constructor.  \p system is this group's copy of the system, whose
+   * time solver must be an UnsteadySolver, and \p time_comm connects
+   * it to the other groups' copies.
+   */
+  PararealSolver (DifferentiableSystem & system,
+                  const Parallel::Communicator & time_comm);
+
+  /**
+   * Destructor.
+   */
+  ~PararealSolver ();
+
+  /**
+   * Attaches the coarse propagator.  \p coarse_solver must have been
+   * built for the same, already initialized, system; it is
+   * initialized here.
+   */
+  void attach_coarse_solver (std::unique_ptr<UnsteadySolver> coarse_solver);
+
+  /**
+   * Reinitializes the coarse propagator after the system has changed.
+   */
+  void reinit ();
+
+  /**
+   * Integrates from the current system solution at \p t_start to \p
+   * t_end.  On return the system solution and time are those at the
+   * end of this group's slice.
+   *
+   * \returns The number of Parareal iterations taken.
+   */
+  unsigned int solve (Real t_start, Real t_end);
+
+  /**
+   * The timesteps used by the fine and coarse propagators.  Each is
+   * shrunk as needed to fit a whole number of steps in a slice.
+   */
+  Real fine_deltat, coarse_deltat;
+
+  /**
+   * The iteration stops once no slice end value changes by more than
+   * \p tolerance in the discrete l2 norm, or after \p max_iterations
+   * iterations.  No more iterations than there are slices are ever
+   * needed.
+   */
+  Real tolerance;
+  unsigned int max_iterations;
+
+  /**
+   * Set to \p false to print the change in each iteration.  Defaults
+   * to \p true.
+   */
+  bool quiet;
+
+private:
+
+  /**
+   * Runs the fine or coarse propagator over [\p t0, \p t1] starting
+   * from the local solution values \p start, and \returns the local
+   * solution values at \p t1.
+   */
+  std::vector<Number> propagate (bool coarse,
+                                 const std::vector<Number> & start,
+                                 Real t0,
+                                 Real t1);
+
+  /**
+   * Copies the local entries of the system solution into or out of
+   * \p values.
+   */
+  void get_local_solution (std::vector<Number> & values) const;
+  void set_local_solution (const std::vector<Number> & values);
+
+  DifferentiableSystem & _system;
+
+  std::unique_ptr<UnsteadySolver> _coarse_solver;
+};
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_PARAREAL_SOLVER_H
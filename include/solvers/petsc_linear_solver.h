@@ -173,6 +173,37 @@ public:
                  const std::optional<double> tol = std::nullopt,
                  const std::optional<unsigned int> m_its = std::nullopt) override;
 
+  /**
+   * Solves for all the right-hand sides at once with KSPMatSolve(),
+   * so that a direct solver factors the matrix once and applies the
+   * factorization to every column, and block Krylov methods such as
+   * KSPHPDDM can share their search space.  The iteration count and
+   * residual of the block solve are reported for every right-hand
+   * side.
+   *
+   * Restricted solves, shell preconditioners and PETSc older than
+   * 3.14 fall back to solving one right-hand side at a time.
+   */
+  virtual std::vector<std::pair<unsigned int, Real>>
+  solve_multiple_rhs (SparseMatrix<T> & matrix_in,
+                      const std::vector<NumericVector<T> *> & solutions,
+                      const std::vector<NumericVector<T> *> & rhs,
+                      const std::optional<double> tol = std::nullopt,
+                      const std::optional<unsigned int> m_its = std::nullopt) override;
+
+  /**
+   * Solves the adjoint system for all the right-hand sides at once
+   * with KSPMatSolveTranspose(), as solve_multiple_rhs() does for the
+   * forward system.  PETSc older than 3.17 falls back to solving one
+   * right-hand side at a time.
+   */
+  virtual std::vector<std::pair<unsigned int, Real>>
+  adjoint_solve_multiple_rhs (SparseMatrix<T> & matrix_in,
+                              const std::vector<NumericVector<T> *> & solutions,
+                              const std::vector<NumericVector<T> *> & rhs,
+                              const std::optional<double> tol = std::nullopt,
+                              const std::optional<unsigned int> m_its = std::nullopt) override;
+
   /**
    * This method allows you to call a linear solver while specifying
    * the matrix to use as the (left) preconditioning matrix.
@@ -274,6 +305,22 @@ private:
                 const unsigned int m_its,
                 ksp_solve_func_type solve_func);
 
+#if !PETSC_VERSION_LESS_THAN(3,14,0)
+  typedef PetscErrorCode (*ksp_mat_solve_func_type)(KSP,Mat,Mat);
+
+  /*
+   * Helper function to run solve_multiple_rhs() and
+   * adjoint_solve_multiple_rhs() as one block solve
+   */
+  std::vector<std::pair<unsigned int, Real>>
+  solve_multiple_rhs_common (SparseMatrix<T> & matrix_in,
+                             const std::vector<NumericVector<T> *> & solutions,
+                             const std::vector<NumericVector<T> *> & rhs,
+                             const std::optional<double> tol,
+                             const std::optional<unsigned int> m_its,
+                             ksp_mat_solve_func_type solve_func);
+#endif
+
   /*
    * Helper function to run ShellMatrix solve() with or without a
    * separate preconditioner matrix
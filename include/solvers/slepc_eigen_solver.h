@@ -27,6 +27,7 @@
 // Local includes
 #include "libmesh/eigen_solver.h"
 #include "libmesh/slepc_macro.h"
+#include "libmesh/wrapped_petsc.h"
 
 // SLEPc include files.
 EXTERN_C_FOR_SLEPC_BEGIN
@@ -35,6 +36,9 @@ EXTERN_C_FOR_SLEPC_BEGIN
 # include "libmesh/restore_warnings.h"
 EXTERN_C_FOR_SLEPC_END
 
+// C++ includes
+#include <vector>
+
 namespace libMesh
 {
  template <typename T> class PetscVector;
@@ -334,6 +338,12 @@ private:
    * A vector used for initial space. The vector will be used as the basis for EPS.
    */
   PetscVector<T>* _initial_space;
+
+  /**
+   * The eigenvectors converged in the last solve, kept to start the
+   * next solve from if warm starts are enabled.
+   */
+  std::vector<WrappedPetsc<Vec>> _warm_start_space;
 };
 
 } // namespace libMesh
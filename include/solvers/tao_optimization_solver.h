@@ -142,6 +142,15 @@ protected:
    */
   TaoConvergedReason _reason;
 
+  /**
+   * Whether the constraint Jacobians have been assembled since the
+   * solver was last cleared, so that they can be reused when
+   * \p constant_constraints_jacobians is set.
+   */
+  bool _eq_constraints_jac_assembled;
+
+  bool _ineq_constraints_jac_assembled;
+
 private:
 
   friend PetscErrorCode __libmesh_tao_objective (Tao tao, Vec x, PetscReal * objective, void * ctx);
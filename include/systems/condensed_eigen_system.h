@@ -214,6 +214,13 @@ private:
    */
   bool _create_submatrices_in_solve;
 
+  /**
+   * Whether the condensed submatrices have been created for the
+   * current condensed dofs, so that later solves can refill them in
+   * place rather than create them again.
+   */
+  bool _have_condensed_submatrices;
+
   /**
    * The (condensed) system matrix for standard eigenvalue problems.
    */
@@ -138,6 +138,13 @@ public:
                          bool apply_heterogeneous_constraints = false,
                          bool apply_no_constraints = false) override = 0;
 
+  /**
+   * \returns \p true if assembly() brings \link
+   * current_local_solution \endlink up to date itself, so solvers
+   * need not call \link update() \endlink first.
+   */
+  virtual bool assembly_updates_solution () const { return false; }
+
   /**
    * Invokes the solver associated with the system.  For steady state
    * solvers, this will find a root x where F(x) = 0.  For transient
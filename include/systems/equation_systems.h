@@ -36,6 +36,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -319,6 +320,23 @@ public:
   build_parallel_solution_vector(const std::set<std::string> * system_names=nullptr,
                                  bool add_sides=false) const;
 
+  /**
+   * A version of build_solution_vector() for writers which can
+   * consume the solution a piece at a time.  The node-major parallel
+   * solution vector is gathered to processor 0 in slices of at most
+   * \p slice_nodes nodes, and \p consume is called there for each
+   * slice in turn, with the index of the slice's first node and its
+   * values.  No processor ever holds more than one slice beyond its
+   * own share of the parallel vector.
+   *
+   * This must be called on every processor at once.
+   */
+  void stream_solution_vector
+    (const std::function<void (dof_id_type, const std::vector<Number> &)> & consume,
+     const std::set<std::string> * system_names=nullptr,
+     bool add_sides=false,
+     dof_id_type slice_nodes=65536) const;
+
   /**
    * Retrieve \p vars_active_subdomains, which indicates the active
    * subdomains for each variable in \p names.
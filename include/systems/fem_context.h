@@ -25,6 +25,7 @@
 #include "libmesh/id_types.h"
 #include "libmesh/fe_type.h"
 #include "libmesh/fe_base.h"
+#include "libmesh/side_quadrature_cache.h"
 #include "libmesh/vector_value.h"
 
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
@@ -1001,6 +1002,27 @@ public:
   void set_custom_solution(const NumericVector<Number> * custom_sol)
   { _custom_solution = custom_sol; }
 
+  /**
+   * Set a SideQuadratureCache, which must have been update()d for
+   * the current mesh, to use on the sides it covers.  On those sides
+   * side_fe_reinit() leaves the side FE objects alone, and the
+   * cached JxW, points, normals and shape values are available from
+   * get_cached_side() instead.  Set to nullptr to reinitialize the
+   * side FE objects on every side again.
+   *
+   * The cache knows nothing of mesh motion handled by the context
+   * itself, so it can't be used with a mesh system.
+   */
+  void set_side_cache(const SideQuadratureCache * side_cache);
+
+  /**
+   * \returns The cached data on the current side if the last
+   * side_fe_reinit() found it in the side cache, or nullptr if the
+   * side FE objects were reinitialized instead.
+   */
+  const SideQuadratureCache::SideData * get_cached_side() const
+  { return _cached_side; }
+
   /**
    * Calls set_jacobian_tolerance() on all the FE objects controlled
    * by this class. (Actually, it calls this on the underlying)
@@ -1073,6 +1095,14 @@ protected:
    */
   const NumericVector<Number> * _custom_solution;
 
+  /**
+   * Cache to use for side data, and the data found for the current
+   * side
+   */
+  const SideQuadratureCache * _side_cache;
+
+  const SideQuadratureCache::SideData * _cached_side;
+
   mutable std::unique_ptr<FEGenericBase<Real>>         _real_fe;
   mutable std::unique_ptr<FEGenericBase<RealGradient>> _real_grad_fe;
   mutable int _real_fe_derivative_level;
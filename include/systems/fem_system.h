@@ -26,13 +26,18 @@
 
 // C++ includes
 #include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward Declarations
 class DiffContext;
+class Elem;
 class FEMContext;
+class StaticCondensation;
 
 
 /**
@@ -100,6 +105,12 @@ public:
                          bool apply_heterogeneous_constraints = false,
                          bool apply_no_constraints = false) override;
 
+  /**
+   * Recovers the element interior dofs of \p delta if \p
+   * static_condensation is set.
+   */
+  virtual void recover_condensed_dofs (NumericVector<Number> & delta) override;
+
   /**
    * Invokes the solver associated with the system.  For steady state
    * solvers, this will find a root x where F(x) = 0.  For transient
@@ -167,6 +178,31 @@ public:
                                         bool include_liftfunc = true,
                                         bool apply_constraints = true) override;
 
+  /**
+   * Computes \p dest = J \p arg, where J is the Jacobian matrix
+   * which assembly(false, true) would build, without ever assembling
+   * J.  Each element Jacobian is computed and constrained as in
+   * assembly, then applied to the element's entries of \p arg, so
+   * only one element matrix per thread is stored at a time.
+   *
+   * This repeats the element Jacobian evaluations on every product,
+   * in exchange for never storing or streaming through a global
+   * matrix, which can be the better trade for high order elements
+   * with many degrees of freedom each.
+   *
+   * FEMJacobianShellMatrix wraps this as a ShellMatrix for use with
+   * matrix-free linear solvers.
+   */
+  void jacobian_vector_mult (NumericVector<Number> & dest,
+                             const NumericVector<Number> & arg);
+
+  /**
+   * Computes the diagonal of the Jacobian used by
+   * jacobian_vector_mult(), again without assembling it, e.g. for
+   * Jacobi preconditioning of a matrix-free solve.
+   */
+  void jacobian_diagonal (NumericVector<Number> & dest);
+
   /**
    * If fe_reinit_during_postprocess is true (it is true by default), FE
    * objects will be reinit()ed with their default quadrature rules.  If false,
@@ -175,6 +211,44 @@ public:
    */
   bool fe_reinit_during_postprocess;
 
+  /**
+   * Number of constrained element contributions each thread collects
+   * before adding them to the global matrix and residual under a
+   * single lock acquisition.  The default, 1, adds each element as
+   * soon as it's computed.  Larger values reduce lock contention in
+   * threaded assembly at the cost of buffering that many element
+   * matrices per thread.
+   */
+  unsigned int assembly_buffer_size;
+
+  /**
+   * If set to the index of an extra element integer, e.g. one from
+   * MeshBase::add_elem_integer(), each assembly() adds the wall time
+   * in microseconds spent assembling each active local element to
+   * that integer on the element.  The accumulated costs can then
+   * weight a repartitioning; see
+   * ParmetisPartitioner::set_weight_integer().
+   *
+   * The default, libMesh::invalid_uint, disables the timing.
+   */
+  unsigned int assembly_cost_integer;
+
+  /**
+   * If true (it is false by default), assembly() brings
+   * current_local_solution up to date itself, overlapping the
+   * exchange of ghost values with assembly on the elements
+   * DofMap::split_local_elements() finds need none.  Those elements
+   * read their values from the parallel solution, and the rest wait
+   * for the exchange to finish.
+   *
+   * Since assembly() then overwrites current_local_solution, any
+   * changes made to it directly beforehand are lost.
+   */
+  bool overlap_ghost_update;
+
+  virtual bool assembly_updates_solution () const override
+  { return overlap_ghost_update; }
+
   /**
    * If calculating numeric jacobians is required, the FEMSystem
    * will perturb each solution vector entry by numerical_jacobian_h
@@ -199,6 +273,15 @@ public:
 
   void set_numerical_jacobian_h_for_var(unsigned int var_num, Real new_h);
 
+  /**
+   * If this is true, numeric jacobians use one-sided differences
+   * from the unperturbed residual instead of central differences.
+   * That takes n_dofs+1 rather than 2*n_dofs residual evaluations
+   * per element, side or nonlocal term, at the cost of only first
+   * order accuracy in numerical_jacobian_h.  This defaults to false.
+   */
+  bool numerical_jacobian_forward_difference;
+
   /**
    * If verify_analytic_jacobian is equal to zero (as it is by
    * default), no numeric jacobians will be calculated unless
@@ -214,6 +297,32 @@ public:
    */
   Real verify_analytic_jacobians;
 
+  /**
+   * If this is true, assembly() condenses the dofs interior to each
+   * element out of its Jacobian and residual before adding them to
+   * the global system, see StaticCondensation, and solvers recover
+   * them from each linear solution with recover_condensed_dofs().
+   * For high order elements this leaves a much smaller set of dofs
+   * to be solved for globally.  The interior rows of the global
+   * matrix are left as an identity, so the dof numbering is
+   * unchanged.
+   *
+   * Only assembled Jacobians are condensed, not matrix-free
+   * products, and interior face terms are not supported.  This
+   * defaults to false.
+   */
+  bool static_condensation;
+
+  /**
+   * \returns The element interior dof condensation used when \p
+   * static_condensation is set.
+   */
+  StaticCondensation & get_static_condensation()
+  { return *_static_condensation; }
+
+  const StaticCondensation & get_static_condensation() const
+  { return *_static_condensation; }
+
   /**
    * Syntax sugar to make numerical_jacobian() declaration easier.
    */
@@ -255,7 +364,49 @@ protected:
   virtual void init_data () override;
 
 private:
+  /**
+   * Adds the product of the Jacobian with \p local_arg, which must
+   * hold our ghosted dofs, to \p dest; or adds the Jacobian diagonal
+   * if \p local_arg is null.
+   */
+  void add_jacobian_contributions (const NumericVector<Number> * local_arg,
+                                   NumericVector<Number> & dest);
+
+  /**
+   * Adds the FEMPhysics::interior_face_time_derivative() terms on
+   * every face in interior_faces() to the residual and/or Jacobian.
+   */
+  void assemble_interior_faces (FEMPhysics & physics,
+                                bool get_residual,
+                                bool get_jacobian,
+                                bool apply_no_constraints);
+
+  /**
+   * \returns The interior faces this processor assembles, each as one
+   * of our active local elements and its side, listed element by
+   * element.  Every face between active elements appears exactly
+   * once across all processors: the finer element of a non-conforming
+   * face owns it, and between elements of the same level the one
+   * with the lower id does.  The list is rebuilt only when the mesh's
+   * elements have changed.
+   */
+  const std::vector<std::pair<const Elem *, unsigned int>> & interior_faces ();
+
   std::vector<Real> _numerical_jacobian_h_for_var;
+
+  /**
+   * The cached interior_faces(), and the mesh versions they were
+   * found at.
+   */
+  std::vector<std::pair<const Elem *, unsigned int>> _interior_faces;
+
+  bool _interior_faces_built;
+
+  std::size_t _interior_faces_elems_version;
+
+  std::size_t _interior_faces_states_version;
+
+  std::unique_ptr<StaticCondensation> _static_condensation;
 };
 
 // --------------------------------------------------------------
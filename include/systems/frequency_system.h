@@ -179,6 +179,35 @@ public:
    */
   unsigned int n_frequencies () const;
 
+  /**
+   * Splits the processors of \p world into \p n_groups groups of
+   * equal size, for solving disjoint sets of frequencies
+   * concurrently.  \p group_comm returns this processor's group, on
+   * which a complete copy of the mesh and the \p EquationSystems
+   * should be built.  \p across_groups returns the communicator
+   * connecting the processors with the same rank in every group,
+   * which should be given to \p set_frequency_groups().
+   */
+  static void split_frequency_groups (const Parallel::Communicator & world,
+                                      const unsigned int n_groups,
+                                      Parallel::Communicator & group_comm,
+                                      Parallel::Communicator & across_groups);
+
+  /**
+   * Makes this system one of several copies, each on its own group of
+   * processors, which then share out the frequencies: frequency \p n
+   * is solved by the copy whose processors have rank \p n modulo the
+   * number of groups in \p across_groups.  After \p solve(), the
+   * solution vectors of every copy hold the solutions for all the
+   * frequencies, so solution duplicates must be allocated.
+   *
+   * Every copy must have the same mesh and variables, partitioned the
+   * same way, so that processors of equal rank in \p across_groups
+   * own the same dofs.  Pass \p nullptr to go back to solving every
+   * frequency with this copy alone.
+   */
+  void set_frequency_groups (const Parallel::Communicator * across_groups);
+
   /**
    * Register a required user function to use in assembling/solving the system.
    * It is intended to compute frequency-dependent data.  For proper
@@ -274,6 +303,22 @@ protected:
    */
   std::vector<std::pair<unsigned int, Real>> vec_rval;
 
+private:
+
+  /**
+   * Copies the solutions and solver results for frequencies \p
+   * n_start through \p n_stop from the group that solved each of
+   * them to every other group.
+   */
+  void gather_frequency_groups (const unsigned int n_start,
+                                const unsigned int n_stop,
+                                std::vector<std::pair<unsigned int, Real>> & rvals);
+
+  /**
+   * The communicator across the groups of processors sharing out the
+   * frequencies, or \p nullptr if this system solves all of them.
+   */
+  const Parallel::Communicator * _frequency_groups;
 };
 
 
@@ -45,6 +45,7 @@
 
 // C++ Includes
 #include <memory>
+#include <type_traits>
 
 namespace libMesh
 {
@@ -489,6 +490,13 @@ public:
                         bool /*skip_context_check*/)
   { return _f->component(c, i, n, time); }
 
+  void eval_at_points (const FEMContext & c,
+                       unsigned int i,
+                       const std::vector<Point> & points,
+                       const Real time,
+                       std::vector<Output> & values)
+  { _f->component_values(c, i, points, time, values); }
+
   void eval_mixed_derivatives (const FEMContext & /*c*/,
                                unsigned int /*i*/,
                                unsigned int /*dim*/,
@@ -518,6 +526,56 @@ private:
 };
 
 
+/**
+ * Fills \p values with the functor \p f, component \p i, evaluated at
+ * each of \p points.  Functors without a batched evaluation are
+ * evaluated one point at a time; FEMFunctionWrapper passes the whole
+ * batch on to its function.
+ */
+template <typename FFunctor>
+void eval_at_points (FFunctor & f,
+                     const FEMContext & c,
+                     unsigned int i,
+                     const std::vector<Point> & points,
+                     const Real time,
+                     std::vector<typename FFunctor::FunctorValue> & values)
+{
+  values.resize(points.size());
+  for (auto p : index_range(points))
+    values[p] = f.eval_at_point(c, i, points[p], time, false);
+}
+
+template <typename Output>
+void eval_at_points (FEMFunctionWrapper<Output> & f,
+                     const FEMContext & c,
+                     unsigned int i,
+                     const std::vector<Point> & points,
+                     const Real time,
+                     std::vector<Output> & values)
+{
+  f.eval_at_points(c, i, points, time, values);
+}
+
+
+#ifdef LIBMESH_ENABLE_AMR
+/**
+ * \returns The values of the \p fe_type shape functions on \p parent
+ * at each node of its child \p child_num, indexed by child node and
+ * then by parent shape function.
+ *
+ * For LAGRANGE shape functions on an element without p refinement
+ * these depend only on the reference element, so they are computed
+ * once per parent type, child and FEType and cached for every thread
+ * to share; projecting onto a just refined child then needs no FE
+ * reinit at its new nodes.
+ */
+const std::vector<std::vector<Real>> &
+refined_node_shapes (const Elem & parent,
+                     unsigned int child_num,
+                     const FEType & fe_type);
+#endif // LIBMESH_ENABLE_AMR
+
+
 /**
  * The OldSolutionBase input functor abstract base class is the root
  * of the OldSolutionValue and OldSolutionCoefs classes which allow a
@@ -706,6 +764,54 @@ protected:
     return true;
   }
 
+  /**
+   * If \p p is a node of the just refined element in \p c, and
+   * variable \p var can use the refined_node_shapes() cache there,
+   * sets \p val to the old solution at that node and returns true.
+   * The old context must already be on the parent.
+   */
+  bool refined_node_value (const FEMContext & c,
+                           unsigned int var,
+                           const Point & p,
+                           Number & val) const
+  {
+    const Elem & elem = c.get_elem();
+    if (elem.refinement_flag() != Elem::JUST_REFINED ||
+        elem.p_level() || elem.infinite())
+      return false;
+
+    const Elem & parent = *elem.parent();
+    const FEType & fe_type = sys.variable_type(var);
+    if (fe_type.family != LAGRANGE ||
+        parent.p_level() ||
+        parent.type() != elem.type())
+      return false;
+
+    libmesh_assert_equal_to(&old_context.get_elem(), &parent);
+
+    unsigned int node_num = 0;
+    const unsigned int n_nodes = elem.n_nodes();
+    while (node_num != n_nodes && &elem.point(node_num) != &p)
+      ++node_num;
+    if (node_num == n_nodes)
+      return false;
+
+    const std::vector<Real> & phi =
+      refined_node_shapes(parent, parent.which_child_am_i(&elem),
+                          fe_type)[node_num];
+
+    const DenseSubVector<Number> & old_coefs =
+      old_context.get_elem_solution(var);
+    if (phi.size() != old_coefs.size())
+      return false;
+
+    val = 0;
+    for (auto j : index_range(phi))
+      val += phi[j] * old_coefs(j);
+
+    return true;
+  }
+
 protected:
   const Elem * last_elem;
   const System & sys;
@@ -779,6 +885,15 @@ public:
     libmesh_assert_less(i, this->component_to_var.size());
     unsigned int var = this->component_to_var[i];
 
+    // Values at the nodes of refined elements can come from cached
+    // shape function values
+    if constexpr (std::is_same<Output, Number>::value)
+      {
+        Number val;
+        if (this->refined_node_value(c, var, p, val))
+          return val;
+      }
+
     Output n;
     (this->old_context.*point_output)(var, p, n, this->out_of_elem_tol);
     return n;
@@ -3053,23 +3168,26 @@ GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SubProjector::co
   const unsigned int n_qp =
     cast_int<unsigned int>(xyz_values.size());
 
+  // Evaluate the solution, and its gradient if we need it, at every
+  // quadrature point at once
+  std::vector<typename FFunctor::FunctorValue> finevals;
+  eval_at_points(f, context, var_component, xyz_values, system.time,
+                 finevals);
+
+  std::vector<typename GFunctor::FunctorValue> finegrads;
+  if (cont == C_ONE)
+    eval_at_points(*g, context, var_component, xyz_values, system.time,
+                   finegrads);
+
   // Loop over the quadrature points
   for (unsigned int qp=0; qp<n_qp; qp++)
     {
       // solution at the quadrature point
-      FValue fineval = f.eval_at_point(context,
-                                       var_component,
-                                       xyz_values[qp],
-                                       system.time,
-                                       false);
+      FValue fineval = finevals[qp];
       // solution grad at the quadrature point
       typename GFunctor::FunctorValue finegrad;
       if (cont == C_ONE)
-        finegrad = g->eval_at_point(context,
-                                    var_component,
-                                    xyz_values[qp],
-                                    system.time,
-                                    false);
+        finegrad = finegrads[qp];
 
       // Form edge projection matrix
       for (unsigned int sidei=0, freei=0;
@@ -162,6 +162,15 @@ public:
                          bool /* apply_no_constraints */ = false)
   { libmesh_not_implemented(); }
 
+  /**
+   * Replaces the dofs of \p delta, a solution of the linear system
+   * last built by assembly(), which that assembly eliminated from
+   * the system (see e.g. FEMSystem::static_condensation) with their
+   * values in the solution of the full system.  Solvers call this
+   * after each linear solve; by default it does nothing.
+   */
+  virtual void recover_condensed_dofs (NumericVector<Number> & /* delta */) {}
+
   /**
    * Residual parameter derivative function.
    *
@@ -43,6 +43,13 @@ namespace libMesh
  * This class implements inter mesh projection, i.e. projection of
  * vectors defined on a given mesh (from_mesh associated with from_system)
  * to another mesh (to_mesh of to_system).
+ *
+ * When the two meshes were refined from the same coarse mesh, so that
+ * their level 0 elements share unique ids, the source vectors are
+ * evaluated by following the refinement trees from each target
+ * element's coarse ancestor, instead of by locating every projection
+ * point in the source mesh.  Otherwise, or with a distributed source
+ * mesh, MeshFunction point queries are used.
  */
 
 class InterMeshProjection
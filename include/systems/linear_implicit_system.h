@@ -181,8 +181,30 @@ public:
    */
   ShellMatrix<Number> * get_shell_matrix() { return _shell_matrix; }
 
+  /**
+   * Makes solve() use iterative refinement: the residual of each
+   * iterate is computed from the full system matrix, and the linear
+   * solver is only asked to reduce it by \p inner_tolerance before
+   * the resulting correction is added, for at most \p max_steps
+   * corrections, until the residual falls below the linear solver
+   * tolerance relative to the right hand side.  With a cheap,
+   * inexact preconditioner this often reaches a tight tolerance in
+   * fewer total iterations than one accurate solve.
+   *
+   * \p max_steps == 0, the default, disables refinement.
+   */
+  void set_iterative_refinement (unsigned int max_steps,
+                                 double inner_tolerance = 1.e-4);
+
 protected:
 
+  /**
+   * Solves by iterative refinement; see set_iterative_refinement().
+   * \returns The total linear iterations and the final residual norm.
+   */
+  std::pair<unsigned int, Real> refinement_solve (double tol,
+                                                  unsigned int maxits);
+
   /**
    * The number of linear iterations required to solve the linear
    * system Ax=b.
@@ -209,6 +231,12 @@ protected:
    * what happens with the dofs outside the subset.
    */
   SubsetSolveMode _subset_solve_mode;
+
+  /**
+   * The iterative refinement settings.
+   */
+  unsigned int _max_refinement_steps;
+  double _refinement_tolerance;
 };
 
 } // namespace libMesh
@@ -0,0 +1,166 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_STATIC_CONDENSATION_H
+#define LIBMESH_STATIC_CONDENSATION_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+#include "libmesh/id_types.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class FEMContext;
+class System;
+template <typename T> class NumericVector;
+
+/**
+ * This class eliminates the dofs which belong to the interior of a
+ * single element from the element systems assembled by
+ * FEMSystem::assembly(), by forming their Schur complements, and
+ * recovers those dofs afterwards from the solution of the remaining
+ * "skeleton" system.
+ *
+ * An element's interior dofs are those stored on the element itself
+ * and at its nodes which lie on none of its sides, for variables
+ * which are neither SCALAR nor discontinuous; no other element sees
+ * them, so for high order elements a large share of the system can
+ * be solved for locally.  The condensed element Jacobian keeps an
+ * identity on the interior rows, and the condensed residual keeps
+ * the unmodified interior residual there, so the global system and
+ * its dof numbering are unchanged; the interior rows of a linear
+ * solution are then replaced by recover().
+ *
+ * Interior dofs must not be constrained, and must not couple to
+ * any other element.
+ *
+ * \date 2024
+ */
+class StaticCondensation
+{
+public:
+  /**
+   * Constructor, for the element systems of \p sys.
+   */
+  StaticCondensation (const System & sys);
+
+  /**
+   * Condenses the interior dofs out of the element Jacobian and/or
+   * residual in \p context, after any constraints have been applied
+   * to them.  Assembling a Jacobian stores the factors needed to
+   * recover the interior dofs, which a residual-only assembly reuses;
+   * a residual on an element without factors for its current dofs is
+   * left as it is.
+   */
+  void condense (FEMContext & context,
+                 bool get_residual,
+                 bool get_jacobian);
+
+  /**
+   * Replaces the interior dofs of \p delta, a solution of the
+   * condensed Jacobian with the condensed residual on the right hand
+   * side, with their values in the solution of the full system.
+   * Needs a residual to have been condensed on every local element.
+   */
+  void recover (NumericVector<Number> & delta) const;
+
+  /**
+   * Forgets every element's stored factors.
+   */
+  void clear ();
+
+  /**
+   * \returns The number of elements with stored factors.
+   */
+  std::size_t n_condensed_elems () const { return _elem_data.size(); }
+
+  /**
+   * Finds the local indices of the interior dofs of \p elem within
+   * \p dof_indices, and of the remaining dofs.
+   */
+  void interior_dofs (const Elem & elem,
+                      const std::vector<dof_id_type> & dof_indices,
+                      std::vector<unsigned int> & interior,
+                      std::vector<unsigned int> & skeleton) const;
+
+private:
+  /**
+   * The data needed to condense an element residual and to recover
+   * the element's interior dofs, with interior (I) and skeleton (S)
+   * blocks of the element Jacobian J.
+   */
+  struct ElemData
+  {
+    /**
+     * The element's dof indices, as inserted in the global system.
+     */
+    std::vector<dof_id_type> dof_indices;
+
+    /**
+     * The local indices of the interior and skeleton dofs.
+     */
+    std::vector<unsigned int> interior, skeleton;
+
+    /**
+     * The LU factored J_II.
+     */
+    DenseMatrix<Number> interior_jacobian;
+
+    /**
+     * J_SI.
+     */
+    DenseMatrix<Number> skeleton_interior_jacobian;
+
+    /**
+     * J_II^{-1} J_IS.
+     */
+    DenseMatrix<Number> interior_coupling;
+
+    /**
+     * J_II^{-1} R_I, from the latest residual.
+     */
+    DenseVector<Number> interior_solution;
+
+    bool have_residual = false;
+  };
+
+  const System & _sys;
+
+  std::unordered_map<dof_id_type, ElemData> _elem_data;
+
+  /**
+   * Guards insertion into \p _elem_data by assembly threads.
+   */
+  Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_STATIC_CONDENSATION_H
@@ -295,6 +295,21 @@ public:
    */
   virtual void update ();
 
+  /**
+   * Split-phase version of \p update(): starts sending the solution
+   * values needed by neighboring processors, and leaves the transfer
+   * in flight where the vector type allows it.  Until \p update_end()
+   * is called, \p current_local_solution must not be used, but work
+   * on the interior elements from DofMap::split_local_elements() can
+   * read their values from \p solution instead.
+   */
+  void update_begin ();
+
+  /**
+   * Finishes the transfer started by \p update_begin().
+   */
+  void update_end ();
+
   /**
    * Prepares \p matrix and \p _dof_map for matrix assembly.
    * Does not actually assemble anything.  For matrix assembly,
@@ -925,6 +940,40 @@ public:
    */
   bool vector_preservation (std::string_view vec_name) const;
 
+  /**
+   * Allows one to set the boolean controlling whether the preserved
+   * vector identified by vec_name is projected lazily.  A lazily
+   * projected vector keeps its old mesh data through a reinit(), and
+   * is only projected to the new mesh when it is next accessed via
+   * get_vector() or request_vector(), which must then be called on
+   * all processors.  Vectors which are rarely read after a mesh
+   * change then cost nothing to carry along.
+   *
+   * The projection needs the old degree of freedom indices and the
+   * refinement flags of the mesh change, so any pending projections
+   * must happen before the mesh is modified again: either access the
+   * vectors or call project_pending_vectors() first.  EquationSystems
+   * does this itself at the start of each reinit(), which suffices
+   * when it is EquationSystems that refines and coarsens the mesh.
+   * Its own refinement step clears the refinement flags, though, so
+   * projections are only deferred past EquationSystems::reinit() when
+   * it refines the mesh itself or refine_in_reinit is disabled.
+   * Raw access via vectors_begin() does not trigger a projection.
+   */
+  void set_vector_lazy_projection (const std::string & vec_name, bool lazy);
+
+  /**
+   * \returns The boolean describing whether the vector identified by
+   * vec_name is projected lazily.
+   */
+  bool vector_lazy_projection (std::string_view vec_name) const;
+
+  /**
+   * Projects every lazily projected vector which has not been
+   * accessed since the last mesh change.
+   */
+  void project_pending_vectors () const;
+
   /**
    * \returns A reference to one of the system's adjoint solution
    * vectors, by default the one corresponding to the first qoi.
@@ -1958,6 +2007,13 @@ private:
   void late_matrix_init(SparseMatrix<Number> & mat,
                         ParallelType type);
 
+  /**
+   * Projects the vector \p vec_name to the current mesh if it is a
+   * lazily projected vector which hasn't been projected since the
+   * last mesh change.
+   */
+  void project_if_pending (std::string_view vec_name) const;
+
   /**
    * Finds the discrete norm for the entries in the vector
    * corresponding to Dofs associated with var.
@@ -2180,6 +2236,13 @@ private:
    */
   std::map<std::string, int, std::less<>> _vector_is_adjoint;
 
+  /**
+   * The names of the vectors which should be projected lazily, and of
+   * those which still hold old mesh data awaiting that projection.
+   */
+  std::set<std::string, std::less<>> _vector_lazy_projections;
+  mutable std::set<std::string, std::less<>> _pending_projections;
+
   /**
    * Some systems need an arbitrary number of matrices.
    */
@@ -0,0 +1,152 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_VARIATIONAL_SMOOTHER_SYSTEM_H
+#define LIBMESH_VARIATIONAL_SMOOTHER_SYSTEM_H
+
+// Local Includes
+#include "libmesh/fem_system.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * An FEMSystem whose solution is the position of every mesh node, and
+ * whose residual is the gradient of the variational mesh quality
+ * energy of Branets and Carey, the same distortion and dilation
+ * metrics VariationalMeshSmoother uses.  Each quadrature point
+ * contributes
+ *
+ * \f$ (1-\theta) \frac{(\mathrm{tr}\, S^T S / d)^{d/2}}{\det S} +
+ *     \frac{\theta}{2} \left( \frac{\det S}{v} + \frac{v}{\det S} \right) \f$
+ *
+ * where \f$ S \f$ maps an ideal (equilateral or cubic) element to the
+ * moved element, \f$ v \f$ is the mean element size and
+ * \f$ \theta \f$ is the \p dilation_weight.  The first term penalizes
+ * distorted elements, the second elements far from the mean size.
+ *
+ * Assembly and the solve go through the usual FEMSystem machinery,
+ * so they are threaded, work on distributed meshes and use whichever
+ * linear solver package is configured.  The element Jacobians are
+ * computed numerically.  Boundary nodes are fixed by heterogeneous
+ * constraints at their initial positions.
+ *
+ * The system is assembled on the geometry the mesh has when the
+ * solution is initialized, so the mesh nodes should not be moved
+ * until solution_to_positions() is called.  FEVariationalMeshSmoother
+ * wraps the whole process.
+ *
+ * \date 2024
+ * \brief A variational mesh smoothing problem.
+ */
+class VariationalSmootherSystem : public FEMSystem
+{
+public:
+  /**
+   * Constructor.
+   */
+  VariationalSmootherSystem (EquationSystems & es,
+                             const std::string & name,
+                             const unsigned int number);
+
+  /**
+   * Special functions.
+   * - This class has the same restrictions as its base class.
+   * - The destructor is defaulted out-of-line.
+   */
+  VariationalSmootherSystem (const VariationalSmootherSystem &) = delete;
+  VariationalSmootherSystem & operator= (const VariationalSmootherSystem &) = delete;
+  VariationalSmootherSystem (VariationalSmootherSystem &&) = delete;
+  VariationalSmootherSystem & operator= (VariationalSmootherSystem &&) = delete;
+  virtual ~VariationalSmootherSystem ();
+
+  /**
+   * The type of system.
+   */
+  typedef VariationalSmootherSystem sys_type;
+
+  /**
+   * The type of the parent.
+   */
+  typedef FEMSystem Parent;
+
+  /**
+   * Copies the current node positions into the solution.
+   */
+  void positions_to_solution ();
+
+  /**
+   * Moves the mesh nodes to the positions in the solution.
+   */
+  void solution_to_positions ();
+
+  virtual void init_context (DiffContext & context) override;
+
+  virtual bool element_time_derivative (bool request_jacobian,
+                                        DiffContext & context) override;
+
+  /**
+   * The weight \f$ \theta \f$ of the dilation metric against the
+   * distortion metric, between 0 and 1.  Defaults to 0.5.
+   */
+  Real dilation_weight;
+
+protected:
+
+  /**
+   * Adds a coordinate variable for each mesh dimension and finds the
+   * mean element size.
+   */
+  virtual void init_data () override;
+
+private:
+
+  /**
+   * Fixes the boundary nodes at their current positions.
+   */
+  class BoundaryConstraint : public System::Constraint
+  {
+  public:
+    BoundaryConstraint (VariationalSmootherSystem & sys) : _sys(sys) {}
+
+    virtual void constrain () override;
+
+  private:
+    VariationalSmootherSystem & _sys;
+  };
+
+  BoundaryConstraint _boundary_constraint;
+
+  /**
+   * The variable holding each coordinate of the node positions.
+   */
+  std::vector<unsigned int> _coord_vars;
+
+  /**
+   * The mean size of the elements, relative to their ideal shapes.
+   */
+  Real _target_size;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_VARIATIONAL_SMOOTHER_SYSTEM_H
@@ -0,0 +1,83 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_COMPENSATED_SUM_H
+#define LIBMESH_COMPENSATED_SUM_H
+
+// C++ includes
+#include <cmath>
+
+namespace libMesh
+{
+
+/**
+ * A running sum of floating point values which also tracks the
+ * rounding error lost by each addition (the Kahan-Babuska, or
+ * Neumaier, algorithm), so that the result is accurate to nearly
+ * the working precision regardless of the number of terms or the
+ * order in which they are added.
+ *
+ * Partial sums, e.g. from different threads, can be combined with
+ * \p join() without losing their compensation.
+ *
+ * \date 2024
+ */
+template <typename T>
+class CompensatedSum
+{
+public:
+  CompensatedSum () : _sum(0), _compensation(0) {}
+
+  /**
+   * Adds \p x to the sum.
+   */
+  CompensatedSum & operator+= (const T x)
+  {
+    const T t = _sum + x;
+    if (std::abs(_sum) >= std::abs(x))
+      _compensation += (_sum - t) + x;
+    else
+      _compensation += (x - t) + _sum;
+    _sum = t;
+    return *this;
+  }
+
+  /**
+   * Adds the partial sum \p other to this sum.
+   */
+  void join (const CompensatedSum & other)
+  {
+    *this += other._sum;
+    _compensation += other._compensation;
+  }
+
+  /**
+   * \returns The compensated value of the sum.
+   */
+  T value () const { return _sum + _compensation; }
+
+private:
+  T _sum;
+
+  T _compensation;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_COMPENSATED_SUM_H
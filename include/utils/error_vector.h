@@ -22,14 +22,18 @@
 
 // Local Includes
 #include "libmesh/statistics.h"
+#include "libmesh/parallel_object.h"
 
 // C++ includes
 #include <cstddef>
+#include <string>
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward Declarations
+class Elem;
 class MeshBase;
 class Mesh;
 
@@ -163,6 +167,149 @@ protected:
   MeshBase * _mesh;
 };
 
+
+
+/**
+ * The \p DistributedErrorVector holds the error on only the active
+ * elements each processor owns, instead of on every element of the
+ * mesh as an \p ErrorVector does, so that its memory scales with the
+ * local part of the mesh.  Its statistics are computed with
+ * reductions of a few numbers per processor, and must be called on
+ * every processor at once; the MeshRefinement flagging functions
+ * which take one flag the local elements and then make their flags
+ * parallel consistent.
+ *
+ * \date 2024
+ */
+class DistributedErrorVector : public ParallelObject
+{
+public:
+  /**
+   * Constructor.  Holds a zero error for each active local element of
+   * \p mesh.
+   */
+  DistributedErrorVector (const MeshBase & mesh);
+
+  /**
+   * Constructor.  Holds the errors in \p error_per_cell on the active
+   * local elements of \p mesh, e.g. as computed by an ErrorEstimator.
+   */
+  DistributedErrorVector (const MeshBase & mesh,
+                          const ErrorVector & error_per_cell);
+
+  /**
+   * \returns A writable reference to the error on \p elem, which must
+   * be an active local element.
+   */
+  ErrorVectorReal & operator() (const Elem & elem);
+
+  /**
+   * \returns The error on \p elem, which must be an active local
+   * element.
+   */
+  ErrorVectorReal operator() (const Elem & elem) const;
+
+  /**
+   * \returns The ids of the elements whose errors we hold, in
+   * increasing order.
+   */
+  const std::vector<dof_id_type> & elem_ids () const { return _elem_ids; }
+
+  /**
+   * \returns The errors we hold, in the order of \p elem_ids().
+   */
+  const std::vector<ErrorVectorReal> & values () const { return _values; }
+
+  std::vector<ErrorVectorReal> & values () { return _values; }
+
+  /**
+   * \returns The number of active elements on all processors.
+   */
+  dof_id_type n_active_elem () const;
+
+  /**
+   * \returns The minimum error over all processors.
+   */
+  ErrorVectorReal minimum () const;
+
+  /**
+   * \returns The maximum error over all processors.
+   */
+  ErrorVectorReal maximum () const;
+
+  /**
+   * \returns The mean error over all processors.
+   */
+  Real mean () const;
+
+  /**
+   * \returns The variance of the error over all processors,
+   * normalized by the number of elements.
+   */
+  Real variance () const
+  { return this->variance(this->mean()); }
+
+  /**
+   * \returns The variance of the error over all processors given its
+   * \p mean, which saves one reduction.
+   */
+  Real variance (const Real mean) const;
+
+  /**
+   * \returns The standard deviation of the error over all processors.
+   */
+  Real stddev () const;
+
+  /**
+   * \returns The l2 norm of the error over all processors.
+   */
+  Real l2_norm () const;
+
+  /**
+   * Fills \p bin_members with the number of elements on all
+   * processors in each of \p n_bins equal bins between the minimum
+   * and maximum error, as StatisticsVector::histogram() does.  Only
+   * the bin counts are reduced.
+   */
+  void histogram (std::vector<dof_id_type> & bin_members,
+                  unsigned int n_bins = 10) const;
+
+  /**
+   * Fills \p bin_members with the number of elements on all
+   * processors with errors up to the top of each \p histogram() bin,
+   * i.e. the running sum of the histogram.
+   */
+  void cumulative_histogram (std::vector<dof_id_type> & bin_members,
+                             unsigned int n_bins = 10) const;
+
+  /**
+   * \returns The ids of the local elements with errors below \p cut.
+   */
+  std::vector<dof_id_type> cut_below (Real cut) const;
+
+  /**
+   * \returns The ids of the local elements with errors above \p cut.
+   */
+  std::vector<dof_id_type> cut_above (Real cut) const;
+
+  /**
+   * Plots the errors on the active elements of \p mesh, as
+   * ErrorVector::plot_error() does.
+   */
+  void plot_error (const std::string & filename,
+                   const MeshBase & mesh) const;
+
+private:
+  /**
+   * \returns The position of the error for element \p id.
+   */
+  std::size_t index (dof_id_type id) const;
+
+  std::vector<dof_id_type> _elem_ids;
+
+  std::vector<ErrorVectorReal> _values;
+};
+
 } // namespace libMesh
 
 #endif // LIBMESH_ERROR_VECTOR_H
@@ -18,7 +18,9 @@
 #ifndef LIBMESH_HASHING_H
 #define LIBMESH_HASHING_H
 
+#include <array>
 #include <functional>
+#include <vector>
 
 namespace libMesh
 {
@@ -54,6 +56,30 @@ public:
 
     return returnval;
   }
+
+  template <typename T>
+  std::size_t operator()(const std::vector<T> & x) const
+  {
+    using std::hash;
+
+    std::size_t returnval = x.size();
+    for (const auto & v : x)
+      boostcopy::hash_combine(returnval, v);
+
+    return returnval;
+  }
+
+  template <typename T, std::size_t N>
+  std::size_t operator()(const std::array<T, N> & x) const
+  {
+    using std::hash;
+
+    std::size_t returnval = N;
+    for (const auto & v : x)
+      boostcopy::hash_combine(returnval, v);
+
+    return returnval;
+  }
 };
 
 
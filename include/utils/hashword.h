@@ -93,43 +93,117 @@ void final(uint32_t & a, uint32_t & b, uint32_t & c)
 
 
 /**
- * fnv_64_buf - perform a 64 bit Fowler/Noll/Vo hash on a buffer.
- * http://www.isthe.com/chongo/tech/comp/fnv/index.html
+ * The 64-bit primes of the XXH64 hash.
  *
- * \author Phong Vo (http://www.research.att.com/info/kpv/)
- * \author Glenn Fowler (http://www.research.att.com/~gsf/)
- * \author Landon Curt Noll (http://www.isthe.com/chongo/)
- * \date 1991, 2012
- * \copyright Public Domain
- *
- * \param buf start of buffer to hash
- * \param len length of buffer in octets
- * \returns 64 bit hash as a static hash type
+ * \author Yann Collet
+ * \copyright BSD 2-Clause
+ * https://github.com/Cyan4973/xxHash
+ */
+const uint64_t xxh_prime1 = 0x9E3779B185EBCA87ULL;
+const uint64_t xxh_prime2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t xxh_prime3 = 0x165667B19E3779F9ULL;
+const uint64_t xxh_prime4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t xxh_prime5 = 0x27D4EB2F165667C5ULL;
+
+
+
+/**
+ * Rotate x left by k bits.
+ */
+inline
+uint64_t rotl64(uint64_t x, unsigned int k)
+{
+  return (x<<k) | (x>>(64-k));
+}
+
+
+
+/**
+ * Accumulate one 64-bit word into an XXH64 lane.
+ */
+inline
+uint64_t xxh64_round(uint64_t acc, uint64_t k)
+{
+  acc += k * xxh_prime2;
+  acc = rotl64(acc, 31);
+  return acc * xxh_prime1;
+}
+
+
+
+/**
+ * Merge an XXH64 lane into the combined hash.
  */
-uint64_t fnv_64_buf(const void * buf, size_t len)
+inline
+uint64_t xxh64_merge(uint64_t h, uint64_t acc)
 {
-  // Initializing hval with this value corresponds to the FNV-1 hash algorithm.
-  uint64_t hval = static_cast<uint64_t>(0xcbf29ce484222325ULL);
+  h ^= xxh64_round(0, acc);
+  return h * xxh_prime1 + xxh_prime4;
+}
 
-  // start of buffer
-  const unsigned char * bp = static_cast<const unsigned char *>(buf);
 
-  // beyond end of buffer
-  const unsigned char * be = bp + len;
 
-  // FNV-1 hash each octet of the buffer
-  while (bp < be)
+/**
+ * Hash \p length 64-bit words in the manner of XXH64: four
+ * independent lanes (which the compiler can keep in registers or
+ * vectorize) for blocks of four words, one word at a time for the
+ * rest, and a final avalanche so that every input bit affects every
+ * output bit.  Only multiplies, rotates and xors are needed, so this
+ * is much cheaper than a byte-wise hash of the same words.
+ *
+ * The words are hashed as values, not bytes, so the result is the
+ * same on every platform, and matches XXH64 of the little-endian
+ * bytes.
+ *
+ * \author Yann Collet
+ * \copyright BSD 2-Clause
+ * https://github.com/Cyan4973/xxHash
+ */
+inline
+uint64_t xxh64_words(const uint64_t * k, size_t length, uint64_t seed=0)
+{
+  const uint64_t * const end = k + length;
+  uint64_t h;
+
+  if (length >= 4)
     {
-      hval +=
-        (hval << 1) + (hval << 4) + (hval << 5) +
-        (hval << 7) + (hval << 8) + (hval << 40);
+      uint64_t v1 = seed + xxh_prime1 + xxh_prime2;
+      uint64_t v2 = seed + xxh_prime2;
+      uint64_t v3 = seed;
+      uint64_t v4 = seed - xxh_prime1;
+
+      for (; end - k >= 4; k += 4)
+        {
+          v1 = xxh64_round(v1, k[0]);
+          v2 = xxh64_round(v2, k[1]);
+          v3 = xxh64_round(v3, k[2]);
+          v4 = xxh64_round(v4, k[3]);
+        }
+
+      h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+      h = xxh64_merge(h, v1);
+      h = xxh64_merge(h, v2);
+      h = xxh64_merge(h, v3);
+      h = xxh64_merge(h, v4);
+    }
+  else
+    h = seed + xxh_prime5;
+
+  h += static_cast<uint64_t>(length) * 8;
 
-      // xor the bottom with the current octet
-      hval ^= static_cast<uint64_t>(*bp++);
+  for (; k != end; ++k)
+    {
+      h ^= xxh64_round(0, *k);
+      h = rotl64(h, 27) * xxh_prime1 + xxh_prime4;
     }
 
-  // return our new hash value
-  return hval;
+  h ^= h >> 33;
+  h *= xxh_prime2;
+  h ^= h >> 29;
+  h *= xxh_prime3;
+  h ^= h >> 32;
+
+  return h;
 }
 
 } // end anonymous namespace
@@ -222,18 +296,13 @@ uint32_t hashword2(const uint32_t & first, const uint32_t & second, uint32_t ini
 }
 
 /**
- * Call the 64-bit FNV hash function.
+ * Call the 64-bit XXH64-style hash function on exactly 2 numbers.
  */
 inline
 uint64_t hashword2(const uint64_t first, const uint64_t second)
 {
-  // This isn't optimal (it would be nice to avoid this packing step)
-  // but we are going to go ahead and conform to the 32-bit
-  // hashword2() interface.
-  uint64_t k[2] = {first, second};
-
-  // len is the total number of bytes in two 64-bit ints
-  return fnv_64_buf(k, /*len=*/8*2);
+  const uint64_t k[2] = {first, second};
+  return xxh64_words(k, 2);
 }
 
 inline
@@ -243,12 +312,15 @@ uint16_t hashword2(const uint16_t first, const uint16_t second)
 }
 
 /**
- * Call the 64-bit FNV hash function.
+ * Call the 64-bit XXH64-style hash function.
+ *
+ * This used to be a byte-wise FNV hash; keys computed with it are
+ * not meant to be stored, and changed value along with it.
  */
 inline
 uint64_t hashword(const uint64_t * k, size_t length)
 {
-  return fnv_64_buf(k, 8*length);
+  return xxh64_words(k, length);
 }
 
 
@@ -0,0 +1,370 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PAGED_MAPVECTOR_H
+#define LIBMESH_PAGED_MAPVECTOR_H
+
+// C++ Includes   -----------------------------------
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This \p paged_mapvector templated class provides the same
+ * interface as \p mapvector and \p chunked_mapvector, for use with
+ * DistributedMesh, but with constant time lookup.
+ *
+ * Entries are stored in fixed size arrays, "pages" of \p N entries,
+ * and a plain vector of pages is indexed directly by \p k/N.  Pages
+ * in which no entry has ever been set are never allocated, and pages
+ * are freed again once every entry in them is erased, so a range of
+ * unused ids costs one null pointer per page.  Iteration walks the
+ * allocated pages in id order.
+ *
+ * References to entries stay valid until their page is freed, and
+ * iterators stay valid when other pages are added.
+ *
+ * \date 2024
+ */
+
+template <typename Val, typename index_t=unsigned int, unsigned int N=256>
+class paged_mapvector
+{
+public:
+  typedef std::array<Val,N> page_type;
+
+  typedef unsigned int iter_t; // Only has to hold 0 through N
+
+  // The page index of every past-the-end iterator, so that end() stays
+  // valid as pages are added
+  static constexpr std::size_t end_page = std::numeric_limits<std::size_t>::max();
+
+  class const_veclike_iterator;
+
+  template <typename Container>
+  class veclike_iterator_base
+  {
+  public:
+    veclike_iterator_base(Container * c,
+                          const std::size_t p,
+                          const iter_t idx)
+      : container(c), page(p), array_index(idx) {}
+
+    veclike_iterator_base(const veclike_iterator_base & i) = default;
+
+    veclike_iterator_base & operator= (const veclike_iterator_base & i) = default;
+
+    veclike_iterator_base & operator++()
+    {
+      ++array_index;
+      if (array_index >= N)
+        {
+          array_index = 0;
+          page = container->next_page(page);
+        }
+      return *this;
+    }
+
+    veclike_iterator_base operator++(int)
+    {
+      veclike_iterator_base i = *this;
+      ++(*this);
+      return i;
+    }
+
+    bool operator==(const veclike_iterator_base & other) const
+    {
+      return (page == other.page && array_index == other.array_index);
+    }
+
+    bool operator!=(const veclike_iterator_base & other) const
+    {
+      return (page != other.page || array_index != other.array_index);
+    }
+
+    index_t index() const { return static_cast<index_t>(page * N + array_index); }
+
+  protected:
+    friend class paged_mapvector;
+    friend class const_veclike_iterator;
+
+    Container * container;
+
+    std::size_t page;
+
+    iter_t array_index;
+  };
+
+  class veclike_iterator :
+    public veclike_iterator_base<paged_mapvector>
+  {
+  public:
+    veclike_iterator(paged_mapvector * c,
+                     const std::size_t p,
+                     const iter_t idx)
+      : veclike_iterator_base<paged_mapvector>(c,p,idx) {}
+
+    Val & operator*() const { return (*this->container->_pages[this->page])[this->array_index]; }
+
+    Val * operator->() const { return &(**this); }
+  };
+
+
+  class const_veclike_iterator :
+    public veclike_iterator_base<const paged_mapvector>
+  {
+  public:
+    const_veclike_iterator(const paged_mapvector * c,
+                           const std::size_t p,
+                           const iter_t idx)
+      : veclike_iterator_base<const paged_mapvector>(c,p,idx) {}
+
+    const_veclike_iterator(const veclike_iterator & i)
+      : veclike_iterator_base<const paged_mapvector>(i.container, i.page, i.array_index) {}
+
+    const Val & operator*() const { return (*this->container->_pages[this->page])[this->array_index]; }
+
+    const Val * operator->() const { return &(**this); }
+  };
+
+  class const_reverse_veclike_iterator
+  {
+  public:
+    const_reverse_veclike_iterator(const paged_mapvector * c,
+                                   const std::size_t p,
+                                   const iter_t idx)
+      : container(c), page(p), array_index(idx) {}
+
+    const_reverse_veclike_iterator(const const_reverse_veclike_iterator & i) = default;
+
+    const_reverse_veclike_iterator & operator++()
+    {
+      if (array_index == 0)
+        {
+          array_index = N-1;
+          page = container->prev_page(page);
+        }
+      else
+        --array_index;
+      return *this;
+    }
+
+    const_reverse_veclike_iterator operator++(int)
+    {
+      const_reverse_veclike_iterator i = *this;
+      ++(*this);
+      return i;
+    }
+
+    const Val & operator*() const { return (*container->_pages[page])[array_index]; }
+
+    const Val * operator->() const { return &(**this); }
+
+    index_t index() const { return static_cast<index_t>(page * N + array_index); }
+
+    bool operator==(const const_reverse_veclike_iterator & other) const
+    {
+      return (page == other.page && array_index == other.array_index);
+    }
+
+    bool operator!=(const const_reverse_veclike_iterator & other) const
+    {
+      return (page != other.page || array_index != other.array_index);
+    }
+
+  private:
+    const paged_mapvector * container;
+
+    std::size_t page;
+
+    iter_t array_index;
+  };
+
+  veclike_iterator find (const index_t & k)
+  {
+    const std::size_t p = k/N;
+    if (p >= _pages.size() || !_pages[p] || !(*_pages[p])[k%N])
+      return this->end();
+
+    return veclike_iterator(this, p, iter_t(k%N));
+  }
+
+  const_veclike_iterator find (const index_t & k) const
+  {
+    const std::size_t p = k/N;
+    if (p >= _pages.size() || !_pages[p] || !(*_pages[p])[k%N])
+      return this->end();
+
+    return const_veclike_iterator(this, p, iter_t(k%N));
+  }
+
+  Val & operator[] (const index_t & k)
+  {
+    const std::size_t p = k/N;
+    if (p >= _pages.size())
+      _pages.resize(p+1);
+
+    // Value-initialize new pages, so every entry starts out as Val()
+    if (!_pages[p])
+      _pages[p] = std::make_unique<page_type>();
+
+    return (*_pages[p])[k%N];
+  }
+
+  Val operator[] (const index_t & k) const
+  {
+    const std::size_t p = k/N;
+    if (p >= _pages.size() || !_pages[p])
+      return Val();
+
+    return (*_pages[p])[k%N];
+  }
+
+  void erase(index_t i)
+  {
+    const std::size_t p = i/N;
+    if (p >= _pages.size() || !_pages[p])
+      return;
+
+    (*_pages[p])[i%N] = Val();
+    this->free_page_if_empty(p, i%N);
+  }
+
+  veclike_iterator erase(const veclike_iterator & pos)
+  {
+    if (pos.page == end_page)
+      return pos;
+    *pos = Val();
+
+    veclike_iterator newpos = pos;
+    do {
+      ++newpos;
+    } while (newpos.page == pos.page &&
+             *newpos == Val());
+
+    this->free_page_if_empty(pos.page, pos.array_index);
+
+    return newpos;
+  }
+
+  void clear()
+  {
+    _pages.clear();
+  }
+
+  veclike_iterator begin()
+  {
+    return veclike_iterator(this, this->first_page(), 0);
+  }
+
+  const_veclike_iterator begin() const
+  {
+    return const_veclike_iterator(this, this->first_page(), 0);
+  }
+
+  veclike_iterator end()
+  {
+    return veclike_iterator(this, end_page, 0);
+  }
+
+  const_veclike_iterator end() const
+  {
+    return const_veclike_iterator(this, end_page, 0);
+  }
+
+  const_reverse_veclike_iterator rbegin() const
+  {
+    return const_reverse_veclike_iterator(this, this->prev_page(_pages.size()), N-1);
+  }
+
+  const_reverse_veclike_iterator rend() const
+  {
+    return const_reverse_veclike_iterator(this, end_page, N-1);
+  }
+
+private:
+
+  /**
+   * \returns The first allocated page, or \p end_page if there is none.
+   */
+  std::size_t first_page() const
+  {
+    for (std::size_t p = 0, n = _pages.size(); p != n; ++p)
+      if (_pages[p])
+        return p;
+    return end_page;
+  }
+
+  /**
+   * \returns The first allocated page after \p p, or \p end_page if
+   * there is none.
+   */
+  std::size_t next_page(std::size_t p) const
+  {
+    for (++p; p < _pages.size(); ++p)
+      if (_pages[p])
+        return p;
+    return end_page;
+  }
+
+  /**
+   * \returns The last allocated page before \p p, or \p end_page if
+   * there is none.
+   */
+  std::size_t prev_page(std::size_t p) const
+  {
+    while (p-- > 0)
+      if (_pages[p])
+        return p;
+    return end_page;
+  }
+
+  /**
+   * Frees page \p p if every entry in it is now Val().  We start
+   * looking for remaining entries next to the just-erased entry \p
+   * idx, since objects are usually erased in id order.
+   */
+  void free_page_if_empty(const std::size_t p, const iter_t idx)
+  {
+    const page_type & page = *_pages[p];
+    for (iter_t j = idx+1; j < N; ++j)
+      if (page[j] != Val())
+        return;
+    for (iter_t j = 0; j < idx; ++j)
+      if (page[j] != Val())
+        return;
+
+    _pages[p].reset();
+
+    // Don't keep a tail of null pages around
+    while (!_pages.empty() && !_pages.back())
+      _pages.pop_back();
+  }
+
+  std::vector<std::unique_ptr<page_type>> _pages;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_PAGED_MAPVECTOR_H
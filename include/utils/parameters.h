@@ -33,6 +33,7 @@
 #include <typeinfo>
 #include <vector>
 #include <memory>
+#include <utility> // std::move
 
 namespace libMesh
 {
@@ -110,6 +111,13 @@ public:
   /**
    * \returns A constant reference to the specified parameter
    * value.  Requires, of course, that the parameter exists.
+   *
+   * The reference stays valid, and sees any later \p set() of the
+   * same parameter, until that parameter is removed or replaced (by
+   * \p remove(), \p clear(), assignment, \p operator+=, or a \p
+   * set() of a different type).  Code which reads a parameter many
+   * times, e.g. inside an assembly loop, should look it up once and
+   * keep the reference rather than calling \p get() each time.
    */
   template <typename T>
   const T & get (std::string_view) const;
@@ -126,7 +134,8 @@ public:
    * \returns A writable reference to the specified parameter.
    * This method will create the parameter if it does not exist,
    * so it can be used to define parameters which will later be
-   * accessed with the \p get() member.
+   * accessed with the \p get() member.  The reference stays valid
+   * as long as one from \p get() would.
    */
   template <typename T>
   T & set (const std::string &);
@@ -278,6 +287,16 @@ public:
 
 protected:
 
+  /**
+   * \returns A pointer to the parameter of type \p T with the
+   * specified name, or \p nullptr if there is none, with a single
+   * lookup.
+   *
+   * If RTTI has been disabled then the type is not checked.
+   */
+  template <typename T>
+  Parameter<T> * find_parameter (std::string_view) const;
+
   /**
    * Data structure to map names with values.
    */
@@ -392,31 +411,37 @@ std::ostream & operator << (std::ostream & os, const Parameters & p)
 
 template <typename T>
 inline
-bool Parameters::have_parameter (std::string_view name) const
+Parameters::Parameter<T> * Parameters::find_parameter (std::string_view name) const
 {
   Parameters::const_iterator it = _values.find(name);
 
-  if (it != _values.end())
-    {
-#ifdef LIBMESH_HAVE_RTTI
-
-      if (dynamic_cast<const Parameter<T> *>(it->second.get()))
-        return true;
+  if (it == _values.end())
+    return nullptr;
 
+#ifdef LIBMESH_HAVE_RTTI
+  return dynamic_cast<Parameter<T> *>(it->second.get());
 #else // !LIBMESH_HAVE_RTTI
+  // cast_ptr will simply do a static_cast here when RTTI is not
+  // enabled, and it will return a non-nullptr regardless of
+  // whether or not the cast actually succeeds.
+  return cast_ptr<Parameter<T> *>(it->second.get());
+#endif
+}
+
 
-      // cast_ptr will simply do a static_cast here when RTTI is not
-      // enabled, and it will return a non-nullptr regardless of
-      // whether or not the cast actually succeeds.
-      libmesh_warning("Parameters::have_parameter() may return false positives when RTTI is not enabled.");
 
-      if (cast_ptr<const Parameter<T> *>(it->second.get()))
-        return true;
+template <typename T>
+inline
+bool Parameters::have_parameter (std::string_view name) const
+{
+  if (!this->find_parameter<T>(name))
+    return false;
 
+#ifndef LIBMESH_HAVE_RTTI
+  libmesh_warning("Parameters::have_parameter() may return false positives when RTTI is not enabled.");
 #endif
-    }
 
-  return false;
+  return true;
 }
 
 
@@ -425,7 +450,9 @@ template <typename T>
 inline
 const T & Parameters::get (std::string_view name) const
 {
-  if (!this->have_parameter<T>(name))
+  const Parameter<T> * ptr = this->find_parameter<T>(name);
+
+  if (!ptr)
     {
       std::ostringstream oss;
 
@@ -441,14 +468,6 @@ const T & Parameters::get (std::string_view name) const
       libmesh_error_msg(oss.str());
     }
 
-  Parameters::const_iterator it = _values.find(name);
-
-  libmesh_assert(it != _values.end());
-  libmesh_assert(it->second);
-
-  // Get pointer to derived type
-  auto ptr = cast_ptr<Parameter<T> *>(it->second.get());
-
   // Return const reference
   return ptr->get();
 }
@@ -457,7 +476,7 @@ template <typename T>
 inline
 void Parameters::insert (const std::string & name)
 {
-  if (!this->have_parameter<T>(name))
+  if (!this->find_parameter<T>(name))
     _values[name] = std::make_unique<Parameter<T>>();
 
   set_attributes(name, true);
@@ -468,13 +487,17 @@ template <typename T>
 inline
 T & Parameters::set (const std::string & name)
 {
-  if (!this->have_parameter<T>(name))
-    _values[name] = std::make_unique<Parameter<T>>();
+  // Get pointer to existing entry, or add a new one
+  Parameter<T> * ptr = this->find_parameter<T>(name);
 
-  set_attributes(name, false);
+  if (!ptr)
+    {
+      auto new_param = std::make_unique<Parameter<T>>();
+      ptr = new_param.get();
+      _values[name] = std::move(new_param);
+    }
 
-  // Get pointer to existing or just-added entry
-  auto ptr = cast_ptr<Parameter<T> *>(_values[name].get());
+  set_attributes(name, false);
 
   // Return writeable reference
   return ptr->set();
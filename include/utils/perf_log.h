@@ -25,13 +25,16 @@
 #include "libmesh/libmesh_common.h"
 
 // C++ includes
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <stack>
 #include <string>
 #include <vector>
 #include <deque>
 #include <memory>
+#include <mutex>
 #ifdef LIBMESH_HAVE_SYS_TIME_H
 #include <sys/time.h> // gettimeofday() on Unix
 #endif
@@ -42,6 +45,11 @@
 namespace libMesh
 {
 
+// Forward declarations
+namespace Parallel {
+  class Communicator;
+}
+
 /**
  * The \p PerfData class simply contains the performance
  * data that is recorded for individual events.
@@ -138,6 +146,20 @@ protected:
  * This class is particularly useful for finding performance
  * bottlenecks.
  *
+ * Optionally, events logged from inside threaded loops can be
+ * recorded in a separate log for each thread, and printed summed
+ * over threads, and the nesting of events can be recorded as a call
+ * tree and printed after the flat log.
+ *
+ * For dashboards and timeline viewers the log can also be exported as
+ * JSON, with the spread of each event over processors, and the
+ * individual events recorded as a trace in the Chrome trace event
+ * format.
+ *
+ * On Linux, each event can also count hardware events (cycles,
+ * instructions and cache misses) through perf_event, to show where
+ * the memory traffic goes rather than only the time.
+ *
  * \author Benjamin Kirk
  * \date 2003
  * \brief Responsible for timing and summarizing events.
@@ -201,6 +223,98 @@ public:
    */
   bool summarized_logs_enabled() { return summarize_logs; }
 
+  /**
+   * Tells the PerfLog to keep logging inside threaded loops, with
+   * each thread writing only to its own log, rather than disabling
+   * logging for their duration (the default behavior).
+   */
+  void enable_thread_logging() { log_threads = true; }
+
+  /**
+   * Tells the PerfLog to disable logging inside threaded loops.
+   */
+  void disable_thread_logging() { log_threads = false; }
+
+  /**
+   * \returns \p true iff events will be logged inside threaded loops
+   */
+  bool thread_logging_enabled() const { return log_threads; }
+
+  /**
+   * Tells the PerfLog to record which events are nested inside which,
+   * and print the resulting call tree after the flat log.  This costs
+   * an extra map lookup per event.
+   */
+  void enable_call_tree() { log_call_tree = true; }
+
+  /**
+   * Tells the PerfLog to stop recording the call tree.
+   */
+  void disable_call_tree() { log_call_tree = false; }
+
+  /**
+   * \returns \p true iff the call tree is being recorded
+   */
+  bool call_tree_enabled() const { return log_call_tree; }
+
+  /**
+   * Tells the PerfLog to record the start and duration of every
+   * event, for write_chrome_trace().  The record grows with every
+   * event logged, until clear() is called.
+   */
+  void enable_trace() { log_trace = true; }
+
+  /**
+   * Tells the PerfLog to stop recording the trace.
+   */
+  void disable_trace() { log_trace = false; }
+
+  /**
+   * \returns \p true iff the trace is being recorded
+   */
+  bool trace_enabled() const { return log_trace; }
+
+  /**
+   * Tells the PerfLog to count CPU cycles, instructions, L1 data
+   * cache read misses and last level cache misses in every event,
+   * including its sub-events, on the thread which enables them.
+   * The counts are printed in their own table.  Each event then costs
+   * two extra system calls.
+   *
+   * \returns \p false, leaving the counters off, if the operating
+   * system or hardware doesn't provide them; this is only supported
+   * on Linux with perf_event, and may be forbidden by the
+   * perf_event_paranoid setting.
+   */
+  bool enable_hardware_counters();
+
+  /**
+   * Tells the PerfLog to stop counting hardware events.
+   */
+  void disable_hardware_counters();
+
+  /**
+   * \returns \p true iff hardware events are being counted
+   */
+  bool hardware_counters_enabled() const { return hw_counters != nullptr; }
+
+  /**
+   * The number of hardware events counted per event.
+   */
+  static constexpr unsigned int n_hardware_counters = 4;
+
+  /**
+   * Called on the master thread before and after a threaded loop.
+   * Between the two, events are logged to per-thread logs if
+   * thread logging is enabled; otherwise logging is disabled.  The
+   * calls may not be nested.
+   *
+   * \returns From begin_threaded_region(), whether logging was
+   * enabled; this must be passed to end_threaded_region().
+   */
+  bool begin_threaded_region();
+  void end_threaded_region(bool logging_was_enabled);
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    *
@@ -305,6 +419,53 @@ public:
    */
   std::string get_perf_info() const;
 
+  /**
+   * \returns A string containing the events logged inside threaded
+   * loops, summed over threads, or an empty string if there were
+   * none.
+   */
+  std::string get_thread_perf_info() const;
+
+  /**
+   * \returns A string containing the call tree, or an empty string if
+   * it was not recorded.
+   */
+  std::string get_call_tree() const;
+
+  /**
+   * \returns A string containing the hardware counts of each event,
+   * or an empty string if none were counted.
+   */
+  std::string get_hardware_counter_info() const;
+
+  /**
+   * \returns On processor 0 of \p comm, a JSON document with the
+   * call count, time and time including sub-events of every event,
+   * each with its minimum, maximum and mean over the processors and
+   * its value on each processor; an empty string elsewhere.
+   * Processors which never logged an event count as zeroes for it.
+   *
+   * This is a collective operation on \p comm.
+   */
+  std::string get_json(const Parallel::Communicator & comm) const;
+
+  /**
+   * Writes get_json() to \p filename from processor 0 of \p comm.
+   */
+  void write_json(const std::string & filename,
+                  const Parallel::Communicator & comm) const;
+
+  /**
+   * Writes the recorded trace of every processor of \p comm to \p
+   * filename, in the Chrome trace event format read by
+   * chrome://tracing and Perfetto, with one process per processor.
+   * Timestamps come from each processor's system clock.
+   *
+   * This is a collective operation on \p comm.
+   */
+  void write_chrome_trace(const std::string & filename,
+                          const Parallel::Communicator & comm) const;
+
   /**
    * Print the log.
    */
@@ -350,6 +511,26 @@ private:
    */
   bool summarize_logs;
 
+  /**
+   * Flag to optionally log events inside threaded loops
+   */
+  bool log_threads;
+
+  /**
+   * Flag to optionally record the call tree
+   */
+  bool log_call_tree;
+
+  /**
+   * Flag to optionally record a trace of every event
+   */
+  bool log_trace;
+
+  /**
+   * Whether we are inside a threaded loop, logging to per-thread logs
+   */
+  bool in_threaded_region;
+
   /**
    * The total running time for recorded events.
    */
@@ -374,6 +555,136 @@ private:
    */
   std::stack<PerfData*> log_stack;
 
+  /**
+   * The log and trace of one thread inside threaded loops.
+   */
+  struct ThreadLog
+  {
+    log_type log;
+    std::stack<PerfData*> log_stack;
+  };
+
+  /**
+   * \returns The log of the calling thread, claiming one if it has
+   * none yet in this threaded region.  Only the claim is locked;
+   * after that each thread touches nothing but its own log.
+   */
+  ThreadLog & thread_log();
+
+  void thread_push (const char * label,
+                    const char * header);
+
+  void thread_pop () noexcept;
+
+  /**
+   * The per-thread logs, reused by each threaded region in turn, how
+   * many of them have been claimed in the current region, and the
+   * mutex guarding claims.
+   */
+  std::vector<std::unique_ptr<ThreadLog>> thread_logs;
+  std::size_t n_thread_logs_claimed;
+  std::mutex thread_logs_mutex;
+
+  /**
+   * A number identifying this object and its current threaded
+   * region, so that threads can cache which log is theirs.
+   */
+  std::size_t log_id;
+
+  /**
+   * A node of the call tree: the inclusive time and call count of an
+   * event along one call path, and the events called from it.
+   */
+  struct CallTreeNode
+  {
+    std::map<std::pair<const char *, const char *>,
+             std::unique_ptr<CallTreeNode>> children;
+    double time = 0.;
+    unsigned int count = 0;
+  };
+
+  CallTreeNode call_tree_root;
+
+  /**
+   * The open call tree nodes, their keys, and when each was entered.
+   */
+  struct CallTreeFrame
+  {
+    CallTreeNode * node;
+    std::pair<const char *, const char *> key;
+    struct timeval tstart;
+  };
+
+  std::vector<CallTreeFrame> call_tree_stack;
+
+  void call_tree_push (const char * label,
+                       const char * header);
+
+  void call_tree_pop (const char * label,
+                      const char * header) noexcept;
+
+  /**
+   * One recorded event: when it started, since the epoch, and how
+   * long it took, both in microseconds.
+   */
+  struct TraceEvent
+  {
+    const char * label;
+    const char * header;
+    double start;
+    double duration;
+  };
+
+  std::vector<TraceEvent> trace_events;
+
+  /**
+   * The indices in \p trace_events of the open events.
+   */
+  std::vector<std::size_t> trace_stack;
+
+  void trace_push (const char * label,
+                   const char * header);
+
+  void trace_pop (const char * label,
+                  const char * header) noexcept;
+
+  /**
+   * The perf_event counters, or nullptr if we aren't counting.
+   */
+  class HardwareCounters;
+  std::unique_ptr<HardwareCounters> hw_counters;
+
+  /**
+   * The hardware counts of an event, including its sub-events.
+   */
+  struct HardwareCounts
+  {
+    std::array<std::uint64_t, n_hardware_counters> totals {};
+    unsigned int count = 0;
+  };
+
+  std::map<std::pair<const char *, const char *>, HardwareCounts> hw_log;
+
+  /**
+   * The open events and the counter values when each started.
+   */
+  std::vector<std::pair<std::pair<const char *, const char *>,
+                        std::array<std::uint64_t, n_hardware_counters>>> hw_stack;
+
+  void hw_push (const char * label,
+                const char * header);
+
+  void hw_pop (const char * label,
+               const char * header) noexcept;
+
+  /**
+   * Prints \p node and its descendants to \p oss, indented by \p depth.
+   */
+  void print_call_tree (std::ostream & oss,
+                        const std::pair<const char *, const char *> & key,
+                        const CallTreeNode & node,
+                        unsigned int depth) const;
+
   /**
    * Flag indicating if print_log() has been called.
    * This is used to print a header with machine-specific
@@ -496,6 +807,12 @@ void PerfLog::fast_push (const char * label,
 {
   if (this->log_events)
     {
+      if (in_threaded_region)
+        {
+          this->thread_push(label, header);
+          return;
+        }
+
       // Get a reference to the event data to avoid
       // repeated map lookups
       PerfData * perf_data = &(log[std::make_pair(header,label)]);
@@ -505,17 +822,32 @@ void PerfLog::fast_push (const char * label,
       else
         perf_data->start();
       log_stack.push(perf_data);
+
+      if (log_call_tree)
+        this->call_tree_push(label, header);
+
+      if (log_trace)
+        this->trace_push(label, header);
+
+      if (hw_counters)
+        this->hw_push(label, header);
     }
 }
 
 
 
 inline
-void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
-                       const char * libmesh_dbg_var(header)) noexcept
+void PerfLog::fast_pop(const char * label,
+                       const char * header) noexcept
 {
   if (this->log_events)
     {
+      if (in_threaded_region)
+        {
+          this->thread_pop();
+          return;
+        }
+
       // If there's nothing on the stack, then we can't pop anything. Previously we
       // asserted that the log_stack was not empty, but we should not throw from
       // this function, so instead just return in that case.
@@ -580,6 +912,15 @@ void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
 
       log_stack.pop();
 
+      if (log_call_tree)
+        this->call_tree_pop(label, header);
+
+      if (log_trace)
+        this->trace_pop(label, header);
+
+      if (hw_counters)
+        this->hw_pop(label, header);
+
       if (!log_stack.empty())
         log_stack.top()->restart();
     }
@@ -89,6 +89,17 @@ public:
    */
   virtual void init() = 0;
 
+  /**
+   * Updates the point locator after the mesh nodes have moved, without
+   * rebuilding it, when the locator supports that.  Locators sharing
+   * a master's data see the update too.
+   *
+   * \returns \p false if the locator could not be updated and must
+   * be cleared and initialized again instead.  The base class
+   * implementation always returns \p false.
+   */
+  virtual bool refit();
+
   /**
    * Locates the element in which the point with global coordinates
    * \p p is located.  Pure virtual. Optionally allows the user to restrict
@@ -126,6 +137,23 @@ public:
                const std::set<subdomain_id_type> * allowed_subdomains = nullptr,
                Real tol = TOLERANCE) const;
 
+  /**
+   * Locates the element containing each of \p points, storing the
+   * result for \p points[i] in \p elems[i].  The queries are
+   * answered in Morton (Z-curve) order rather than in the order
+   * given, so nearby points are located one after another and
+   * locators which cache their last result can skip most of their
+   * searches.
+   *
+   * Points which are not found are given a \p nullptr result, which
+   * requires out-of-mesh mode just as it does for \p operator().
+   * Optionally allows the user to restrict the subdomains searched.
+   */
+  virtual void
+  locate_points (const std::vector<Point> & points,
+                 std::vector<const Elem *> & elems,
+                 const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const;
+
   /**
    * \returns \p true when this object is properly initialized
    * and ready for use, \p false otherwise.
@@ -190,6 +218,12 @@ public:
    */
   bool get_use_contains_point_tol() const { return _use_contains_point_tol; }
 
+  /**
+   * Likewise, the close_to_point_tol is only used for fallback
+   * searches once the user calls set_close_to_point_tol().
+   */
+  bool get_use_close_to_point_tol() const { return _use_close_to_point_tol; }
+
   /**
    * Get a const reference to this PointLocator's mesh.
    */
@@ -0,0 +1,174 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_LOCATOR_BVH_H
+#define LIBMESH_POINT_LOCATOR_BVH_H
+
+// Local Includes
+#include "libmesh/point_locator_base.h"
+#include "libmesh/bounding_box.h"
+
+// C++ includes
+#include <memory> // std::shared_ptr
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class Point;
+class Elem;
+
+/**
+ * This is a PointLocator built on a bounding volume hierarchy: a
+ * binary tree of axis-aligned boxes whose leaves hold the loose
+ * bounding boxes of the active elements.  The tree is split using
+ * the surface area heuristic, so its shape follows the element
+ * sizes rather than a fixed spatial subdivision, and strongly graded
+ * meshes or sliver elements don't crowd many elements into one bin
+ * the way they can in an octree.
+ *
+ * Use \p PointLocatorBase::build() with the \p BVH type to create
+ * objects of this type at run time.
+ *
+ * \date 2024
+ * \brief PointLocator using a bounding volume hierarchy of elements.
+ */
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points should be
+   * located.  Optionally takes a master PointLocator; if non-nullptr,
+   * this object shares the master's hierarchy instead of building
+   * its own.
+   */
+  PointLocatorBVH (const MeshBase & mesh,
+                   const PointLocatorBase * master = nullptr);
+
+  /**
+   * Destructor.
+   */
+  virtual ~PointLocatorBVH ();
+
+  /**
+   * Restore to PointLocator to a just-constructed state.
+   */
+  virtual void clear() override final;
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.  The element bounding boxes are computed in parallel
+   * over threads.
+   */
+  virtual void init() override final;
+
+  /**
+   * Recomputes every box in the hierarchy, bottom up, for the current
+   * element positions, keeping the tree structure.  Element boxes
+   * are computed in parallel over threads.  Refitting never fails,
+   * but after large deformations the hierarchy no longer splits the
+   * elements well, and a rebuild may search faster.
+   */
+  virtual bool refit() override final;
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, optionally restricted to a set of allowed
+   * subdomains.  If no element contains \p p and a close-to-point
+   * tolerance has been set, elements within that tolerance of \p p
+   * are accepted instead.
+   */
+  virtual const Elem * operator() (const Point & p,
+                                   const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override final;
+
+  /**
+   * Locates all the elements which are within the close-to-point
+   * tolerance of the point with global coordinates \p p, optionally
+   * restricted to a set of allowed subdomains.
+   */
+  virtual void operator() (const Point & p,
+                           std::set<const Elem *> & candidate_elements,
+                           const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override final;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if a searched-for Point
+   * is not contained in any element of the Mesh, return nullptr
+   * instead of throwing an error.  By default, this mode is off.
+   */
+  virtual void enable_out_of_mesh_mode () override final;
+
+  /**
+   * Disables out-of-mesh mode (default).  See above.
+   */
+  virtual void disable_out_of_mesh_mode () override final;
+
+protected:
+
+  /**
+   * A node of the hierarchy.  Leaves hold the \p n_elems elements
+   * starting at \p first in \p _elems; interior nodes have
+   * \p n_elems == 0 and their children at \p first and \p first+1.
+   */
+  struct BVHNode
+  {
+    BoundingBox box;
+    unsigned int first;
+    unsigned int n_elems;
+  };
+
+  /**
+   * Calls \p visit on each element from an allowed subdomain whose
+   * box, enlarged by \p tol times its size, contains \p p, until
+   * \p visit returns \p true.
+   *
+   * \returns The element for which \p visit returned \p true, or
+   * \p nullptr.
+   */
+  template <typename Visitor>
+  const Elem * search (const Point & p,
+                       const std::set<subdomain_id_type> * allowed_subdomains,
+                       Real tol,
+                       Visitor visit) const;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.
+   */
+  bool _out_of_mesh_mode;
+
+  /**
+   * The active elements, ordered so that every leaf's elements are
+   * contiguous, and the hierarchy itself, with the root first.
+   * These are shared with any PointLocator which uses us as its
+   * master.
+   */
+  std::shared_ptr<std::vector<const Elem *>> _elems;
+  std::shared_ptr<std::vector<BVHNode>> _nodes;
+
+  /**
+   * Traversal stack, kept so that it isn't reallocated on every
+   * search.
+   */
+  mutable std::vector<unsigned int> _stack;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_LOCATOR_BVH_H
@@ -98,6 +98,12 @@ public:
    */
   virtual void init() override final;
 
+  /**
+   * Refits the tree in place for the current element positions; see
+   * Tree::refit().
+   */
+  virtual bool refit() override final;
+
   /**
    * Locates the element in which the point with global coordinates
    * \p p is located, optionally restricted to a set of allowed subdomains.
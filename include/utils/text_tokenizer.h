@@ -0,0 +1,368 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TEXT_TOKENIZER_H
+#define LIBMESH_TEXT_TOKENIZER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstddef>
+#include <cstring> // std::memchr, std::memcpy
+#include <iosfwd>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The \p TextTokenizer class holds the whole of an input file in
+ * memory, mapping it rather than copying it where the system allows,
+ * and parses numbers, words and lines directly from it.  This is
+ * much faster than formatted extraction from a stream, which spends
+ * most of its time on locale handling, and matters for the multi-GB
+ * ASCII meshes written by some vendors.
+ *
+ * The interface mimics the small subset of std::istream which the
+ * mesh readers use: \p operator>>, \p getline(), \p peek(), \p get()
+ * and \p unget(), and a conversion to bool which becomes false after
+ * any failed read, so that readers can switch to it with few changes.
+ * Integers are parsed by hand and floating point values with
+ * std::from_chars where the standard library supports it; exponents
+ * written with a Fortran "D" are accepted too.  Lines returned as
+ * views into the buffer can themselves be tokenized without copying.
+ *
+ * Formats which mix text and binary sections, like MSH 4.1, can
+ * switch to reading raw values with \p set_binary().
+ *
+ * \date 2024
+ */
+class TextTokenizer
+{
+public:
+  /**
+   * Maps the file \p filename into memory, or reads it in where
+   * mapping isn't supported.  If the file can't be opened, the
+   * tokenizer starts out failed.
+   */
+  explicit TextTokenizer (const std::string & filename);
+
+  /**
+   * Reads the rest of \p in into memory, for input which isn't a
+   * plain file, e.g. a decompressing stream.
+   */
+  explicit TextTokenizer (std::istream & in);
+
+  /**
+   * Tokenizes \p text in place, e.g. a line returned by another
+   * tokenizer.  The text must outlive this object.
+   */
+  explicit TextTokenizer (std::string_view text);
+
+  ~TextTokenizer ();
+
+  TextTokenizer (const TextTokenizer &) = delete;
+  TextTokenizer & operator= (const TextTokenizer &) = delete;
+
+  /**
+   * \returns \p true if the input was opened and no read has failed.
+   */
+  bool good () const { return !_fail && !_bad; }
+
+  explicit operator bool () const { return this->good(); }
+
+  /**
+   * \returns \p true if the whole input has been consumed.
+   */
+  bool eof () const { return !_bad && _pos == _end; }
+
+  /**
+   * Makes \p next() read values in binary rather than parsing them
+   * as text.
+   */
+  void set_binary (bool binary) { _binary = binary; }
+
+  /**
+   * Makes \p next() reverse the bytes of binary values.
+   */
+  void set_swap (bool swap) { _swap = swap; }
+
+  /**
+   * \returns The next character, without consuming it, or EOF at the
+   * end of the input or after a failure.
+   */
+  int peek () const
+  {
+    if (!this->good() || _pos == _end)
+      return std::char_traits<char>::eof();
+    return static_cast<unsigned char>(*_pos);
+  }
+
+  /**
+   * Consumes and \returns the next character, or EOF after marking
+   * the tokenizer failed at the end of the input.
+   */
+  int get ()
+  {
+    const int c = this->peek();
+    if (c == std::char_traits<char>::eof())
+      _fail = true;
+    else
+      ++_pos;
+    return c;
+  }
+
+  /**
+   * Puts back the last character consumed.
+   */
+  void unget ()
+  {
+    if (this->good() && _pos != _begin)
+      --_pos;
+  }
+
+  /**
+   * Sets \p line to a view of the rest of the current line, up to
+   * \p delim, and consumes the delimiter.  The view stays valid for
+   * the lifetime of the tokenizer.  Fails at the end of the input,
+   * like std::getline().
+   */
+  TextTokenizer & getline (std::string_view & line, char delim = '\n')
+  {
+    line = std::string_view();
+    if (!this->good() || _pos == _end)
+      {
+        _fail = true;
+        return *this;
+      }
+
+    const char * eol =
+      static_cast<const char *>(std::memchr(_pos, delim, _end - _pos));
+    if (!eol)
+      eol = _end;
+
+    line = std::string_view(_pos, eol - _pos);
+    _pos = (eol == _end) ? eol : eol + 1;
+    return *this;
+  }
+
+  /**
+   * Copies the rest of the current line, up to \p delim, into \p s.
+   */
+  TextTokenizer & getline (std::string & s, char delim = '\n')
+  {
+    std::string_view line;
+    this->getline(line, delim);
+    if (this->good())
+      s.assign(line.data(), line.size());
+    return *this;
+  }
+
+  /**
+   * \returns The next value, or a default value after a failure.
+   * Characters and strings are the next non-whitespace character and
+   * word, as with stream extraction.  As with stream extraction too,
+   * negative values wrap around when read into unsigned types.
+   */
+  template <typename T>
+  T next ();
+
+  template <typename T>
+  TextTokenizer & operator>> (T & val)
+  {
+    val = this->next<T>();
+    return *this;
+  }
+
+  /**
+   * Reads the next value on the current line into \p val.  At the
+   * end of the line, consumes the newline and returns false instead.
+   */
+  template <typename T>
+  bool next_on_line (T & val)
+  {
+    while (_pos != _end && (*_pos == ' ' || *_pos == '\t' || *_pos == '\r'))
+      ++_pos;
+
+    if (_pos == _end || *_pos == '\n')
+      {
+        if (_pos != _end)
+          ++_pos;
+        return false;
+      }
+
+    val = this->next<T>();
+    return this->good();
+  }
+
+private:
+  static bool is_space (char c)
+  {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+  }
+
+  void skip_space ()
+  {
+    while (_pos != _end && is_space(*_pos))
+      ++_pos;
+  }
+
+  /**
+   * Reads \p in to the end into our own buffer.
+   */
+  void read_stream (std::istream & in);
+
+  template <typename T>
+  T parse_integer ();
+
+  double parse_real ();
+
+  std::vector<char> _buf;
+
+  /**
+   * The mapped file, if any.
+   */
+  void * _map;
+  std::size_t _map_size;
+
+  const char * _begin;
+  const char * _pos;
+  const char * _end;
+
+  bool _bad, _fail, _binary, _swap;
+};
+
+
+
+// ------------------------------------------------------------
+// TextTokenizer inline methods
+template <typename T>
+inline
+T TextTokenizer::next ()
+{
+  T val {};
+  if (!this->good())
+    return val;
+
+  if constexpr (std::is_same<T, std::string>::value)
+    {
+      this->skip_space();
+      const char * word_end = _pos;
+      while (word_end != _end && !is_space(*word_end))
+        ++word_end;
+
+      if (word_end == _pos)
+        _fail = true;
+      else
+        val.assign(_pos, word_end);
+      _pos = word_end;
+    }
+  else
+    {
+      static_assert(std::is_arithmetic<T>::value,
+                    "TextTokenizer only reads numbers, characters and strings");
+
+      if (_binary)
+        {
+          if (_end - _pos < static_cast<std::ptrdiff_t>(sizeof(T)))
+            {
+              _fail = true;
+              return val;
+            }
+
+          char bytes[sizeof(T)];
+          std::memcpy(bytes, _pos, sizeof(T));
+          if (_swap)
+            std::reverse(bytes, bytes + sizeof(T));
+          std::memcpy(&val, bytes, sizeof(T));
+          _pos += sizeof(T);
+        }
+      else if constexpr (std::is_same<T, char>::value)
+        {
+          this->skip_space();
+          if (_pos == _end)
+            _fail = true;
+          else
+            val = *_pos++;
+        }
+      else if constexpr (std::is_integral<T>::value)
+        val = this->parse_integer<T>();
+      else
+        val = T(this->parse_real());
+    }
+
+  return val;
+}
+
+
+
+template <typename T>
+inline
+T TextTokenizer::parse_integer ()
+{
+  this->skip_space();
+
+  const char * p = _pos;
+  const bool negative = (p != _end && *p == '-');
+  if (p != _end && (*p == '-' || *p == '+'))
+    ++p;
+
+  typedef unsigned long long Magnitude;
+  const char * const digits = p;
+  Magnitude magnitude = 0;
+  bool overflow = false;
+  for (; p != _end && *p >= '0' && *p <= '9'; ++p)
+    {
+      const unsigned int d = *p - '0';
+      overflow |= (magnitude > (std::numeric_limits<Magnitude>::max() - d) / 10);
+      magnitude = magnitude * 10 + d;
+    }
+
+  // The largest magnitude T can hold, one more for negative signed
+  // values
+  const Magnitude max_magnitude =
+    static_cast<Magnitude>(std::numeric_limits<T>::max()) +
+    (std::is_signed<T>::value && negative);
+
+  if (p == digits || overflow || magnitude > max_magnitude)
+    {
+      _fail = true;
+      return T(0);
+    }
+
+  _pos = p;
+
+  if (!negative || !magnitude)
+    return static_cast<T>(magnitude);
+
+  if constexpr (std::is_signed<T>::value)
+    return static_cast<T>(-static_cast<long long>(magnitude - 1) - 1);
+  else
+    return static_cast<T>(T(0) - static_cast<T>(magnitude));
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_TEXT_TOKENIZER_H
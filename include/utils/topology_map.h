@@ -47,8 +47,9 @@ class Node;
  * A node created in the middle of a cell's quad face will be the
  * value of two keys, one for each node pair bracketing it.
  *
- * For efficiency we will use a hashed map if it is available,
- * otherwise a regular map.
+ * For efficiency the keys are stored in a flat open addressing hash
+ * table, which can be sized ahead of time with reserve() when the
+ * number of new nodes can be estimated.
  *
  * \author Roy Stogner
  * \date 2015
@@ -56,12 +57,16 @@ class Node;
  */
 class TopologyMap
 {
-  // We need to supply our own hash function.
-  typedef std::unordered_map<std::pair<dof_id_type, dof_id_type>, dof_id_type, libMesh::hash> map_type;
 public:
   void init(MeshBase &);
 
-  void clear() { _map.clear(); }
+  void clear();
+
+  /**
+   * Makes room for at least \p n bracketing node pairs, so that
+   * adding that many won't need to grow the table.
+   */
+  void reserve(std::size_t n);
 
   /**
    * Add a node to the map, between each pair of specified bracketing
@@ -72,7 +77,12 @@ public:
                 std::pair<dof_id_type, dof_id_type>> &
                 bracketing_nodes);
 
-  bool empty() const { return _map.empty(); }
+  bool empty() const { return !_size; }
+
+  /**
+   * \returns The number of bracketing node pairs in the map.
+   */
+  std::size_t size() const { return _size; }
 
   dof_id_type find(dof_id_type bracket_node1,
                    dof_id_type bracket_node2) const;
@@ -85,7 +95,34 @@ protected:
   void fill(const MeshBase &);
 
 private:
-  map_type          _map;
+  /**
+   * A slot in the table.  Empty slots have an invalid \p lower id.
+   */
+  struct Entry
+  {
+    dof_id_type lower, upper, mid;
+  };
+
+  /**
+   * \returns The index of the slot holding the key
+   * (\p lower, \p upper), or of the empty slot where it belongs.
+   * The table must not be empty.
+   */
+  std::size_t slot(dof_id_type lower, dof_id_type upper) const;
+
+  /**
+   * Moves every entry into a new table of \p capacity slots, which
+   * must be a power of two larger than twice the number of entries.
+   */
+  void rehash(std::size_t capacity);
+
+  /**
+   * The table, probed linearly, with a power of two size and a load
+   * factor of at most one half.
+   */
+  std::vector<Entry> _table;
+
+  std::size_t _size = 0;
 };
 
 } // namespace libMesh
@@ -25,6 +25,7 @@
 #include "libmesh/tree_base.h"
 
 // C++ includes
+#include <unordered_map>
 
 namespace libMesh
 {
@@ -107,6 +108,23 @@ public:
                            const std::set<subdomain_id_type> * allowed_subdomains = nullptr,
                            Real relative_tol = TOLERANCE) const;
 
+  /**
+   * Updates the tree for the current element positions.  Every bin is
+   * pruned of the elements that have left it, and only the elements
+   * whose bounding box has grown past the one they were last binned
+   * with are inserted again.  The first refit has no such boxes to
+   * compare with, so it inserts every element again.  If the elements
+   * have moved out of the root bounding box, the tree is rebuilt in
+   * place around their new bounding box.
+   *
+   * After a refit, every tree holds elements by bounding box, as
+   * an \p ELEMENTS tree does, whatever it was built with.
+   *
+   * \returns \p false if some element could not be inserted, such as
+   * when the elements of a QuadTree have left the xy plane.
+   */
+  virtual bool refit() override;
+
 private:
   /**
    * The tree root.
@@ -117,6 +135,11 @@ private:
    * How the tree is built.
    */
   const Trees::BuildType build_type;
+
+  /**
+   * The bounding box every element had at the last refit().
+   */
+  std::unordered_map<const Elem *, BoundingBox> _elem_boxes;
 };
 
 
@@ -115,6 +115,15 @@ public:
                              const std::set<subdomain_id_type> * allowed_subdomains = nullptr,
                              Real relative_tol = TOLERANCE) const = 0;
 
+  /**
+   * Brings the tree up to date after the mesh nodes have moved,
+   * without rebuilding it from scratch.
+   *
+   * \returns \p false if the tree could not be updated in place and
+   * must be rebuilt instead.
+   */
+  virtual bool refit() = 0;
+
 protected:
 
   /**
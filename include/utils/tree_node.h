@@ -101,6 +101,30 @@ public:
    */
   bool insert (const Elem * nd);
 
+  /**
+   * Inserts \p Elem \p el, whose bounding box is now \p bbox, into
+   * every active TreeNode it intersects which doesn't hold it
+   * already.
+   * \returns \p true iff \p el is held by the TreeNode or one of its
+   * children afterwards.
+   */
+  bool reinsert (const Elem * el,
+                 const BoundingBox & bbox);
+
+  /**
+   * Removes each element from the active TreeNodes at or below this
+   * one whose bounding box, as given by \p elem_boxes, no longer
+   * intersects them.  Elements missing from \p elem_boxes are
+   * removed everywhere.
+   */
+  void prune (const std::unordered_map<const Elem *, BoundingBox> & elem_boxes);
+
+  /**
+   * Removes all children, nodes and elements, leaving an empty active
+   * TreeNode.
+   */
+  void clear ();
+
   /**
    * Refine the tree node into N children if it contains
    * more than tol nodes.
@@ -179,6 +203,20 @@ public:
                       Real relative_tol = TOLERANCE) const;
 
 private:
+  /**
+   * \returns \p true if \p bbox intersects our bounding box.
+   */
+  bool intersects (const BoundingBox & bbox) const;
+
+  /**
+   * Inserts \p el, with bounding box \p bbox, as insert() does;
+   * if \p skip_duplicates then active nodes which already hold \p
+   * el are left alone.
+   */
+  bool insert (const Elem * el,
+               const BoundingBox & bbox,
+               bool skip_duplicates);
+
   /**
    * Look for point \p p in our children,
    * optionally restricted to a set of allowed subdomains.
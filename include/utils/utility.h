@@ -58,6 +58,12 @@ namespace Utility
  */
 std::string system_info();
 
+/**
+ * \returns The largest resident set size this process has reached,
+ * in bytes, or 0 if the operating system doesn't report it.
+ */
+std::size_t peak_memory_usage();
+
 /**
  * Helper struct for enabling template metaprogramming/SFINAE.
  */
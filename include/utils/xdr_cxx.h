@@ -251,6 +251,11 @@ private:
    */
   FILE * fp;
 
+  /**
+   * The buffer used by \p fp.
+   */
+  std::vector<char> fp_buffer;
+
 #endif
 
   /**
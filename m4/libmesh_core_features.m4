@@ -475,6 +475,23 @@ AC_ARG_WITH([mapvector_chunk_size],
 AC_DEFINE_UNQUOTED(MAPVECTOR_CHUNK_SIZE, $mapvector_chunk_size, [size of mapvector chunks])
 AC_MSG_RESULT([configuring size of mapvector chunks: $mapvector_chunk_size])
 
+# -------------------------------------------------------------
+# DistributedMesh storage in id-indexed pages -- disabled by default.
+# This gives constant time object lookup, at the cost of one pointer
+# per 256 ids up to the largest id on each processor.
+# -------------------------------------------------------------
+AC_ARG_ENABLE(paged-mapvector,
+              AS_HELP_STRING([--enable-paged-mapvector],
+                             [Store DistributedMesh objects in id-indexed pages instead of maps]),
+              enablepagedmapvector=$enableval,
+              enablepagedmapvector=no)
+
+AS_IF([test "$enablepagedmapvector" != no],
+      [
+        AC_DEFINE(ENABLE_PAGED_MAPVECTOR, 1, [Flag indicating if DistributedMesh should store objects in id-indexed pages])
+        AC_MSG_RESULT(<<< Configuring DistributedMesh with paged object storage >>>)
+      ])
+
 
 
 
@@ -15,6 +15,7 @@
 #include <libmesh/numeric_vector.h>
 #include <libmesh/system.h>
 #include <libmesh/quadrature_gauss.h>
+#include <libmesh/tensor_product_kernel.h>
 
 #include <vector>
 
@@ -29,7 +30,11 @@
   CPPUNIT_TEST( testHessU );                    \
   CPPUNIT_TEST( testHessUComp );                \
   CPPUNIT_TEST( testDualDoesntScreamAndDie );   \
-  CPPUNIT_TEST( testCustomReinit );
+  CPPUNIT_TEST( testCustomReinit );             \
+  CPPUNIT_TEST( testReinitBatch );              \
+  CPPUNIT_TEST( testAllShapes );                \
+  CPPUNIT_TEST( testSharedReferenceValues );     \
+  CPPUNIT_TEST( testTensorProductKernel );
 
 using namespace libMesh;
 
@@ -923,6 +928,216 @@ public:
     }
   }
 
+  void testReinitBatch()
+  {
+    LOG_UNIT_TEST;
+
+    // Handle the "more processors than elements" case
+    if (!this->_elem)
+      return;
+
+    // Only first derivatives, so we can take the vectorized path
+    // where it's supported
+    FEType fe_type = this->_sys->variable_type(0);
+    std::unique_ptr<FEBase> fe (FEBase::build(this->_dim, fe_type));
+    fe->attach_quadrature_rule (this->_qrule.get());
+    const std::vector<Real> & JxW = fe->get_JxW();
+    const std::vector<std::vector<Real>> & phi = fe->get_phi();
+    const std::vector<std::vector<Real>> & dphidx = fe->get_dphidx();
+    const std::vector<std::vector<Real>> & dphidy = fe->get_dphidy();
+    const std::vector<std::vector<Real>> & dphidz = fe->get_dphidz();
+
+    // Use the same element twice, to test the batch indexing too
+    const std::vector<const Elem *> elems {this->_elem, this->_elem};
+    FEBase::BatchValues values;
+    fe->reinit_batch(elems, values);
+
+    fe->reinit(this->_elem);
+
+    CPPUNIT_ASSERT_EQUAL(values.n_elem, 2u);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(values.n_qp), JxW.size());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(values.n_shapes), phi.size());
+
+    for (unsigned int e = 0; e != values.n_elem; ++e)
+      for (unsigned int qp = 0; qp != values.n_qp; ++qp)
+        {
+          LIBMESH_ASSERT_FP_EQUAL(JxW[qp], values.JxW[qp*values.n_elem + e],
+                                  this->_value_tol);
+          for (unsigned int i = 0; i != values.n_shapes; ++i)
+            {
+              const std::size_t k = values.index(i, qp, e);
+              LIBMESH_ASSERT_FP_EQUAL(phi[i][qp], values.phi[k], this->_value_tol);
+              LIBMESH_ASSERT_FP_EQUAL(dphidx[i][qp], values.dphidx[k], this->_grad_tol);
+              LIBMESH_ASSERT_FP_EQUAL(dphidy[i][qp], values.dphidy[k], this->_grad_tol);
+              LIBMESH_ASSERT_FP_EQUAL(dphidz[i][qp], values.dphidz[k], this->_grad_tol);
+            }
+        }
+  }
+
+  void testAllShapes()
+  {
+    LOG_UNIT_TEST;
+
+    // Handle the "more processors than elements" case
+    if (!this->_elem)
+      return;
+
+    // Fill in the quadrature points for this element type
+    this->_fe->reinit(this->_elem);
+    const std::vector<Point> & qp = this->_qrule->get_points();
+
+    FEType fe_type = this->_sys->variable_type(0);
+    const unsigned int n_shapes =
+      FEInterface::n_shape_functions(fe_type, this->_elem);
+
+    // Evaluating every shape function at once should match
+    // evaluating them one at a time
+    std::vector<std::vector<Real>> phi(n_shapes, std::vector<Real>(qp.size()));
+    FEInterface::all_shapes(this->_dim, fe_type, this->_elem, qp, phi);
+
+    std::vector<std::vector<std::vector<Real>>> dphi(this->_dim, phi);
+    std::vector<std::vector<Real>> * comps[3] {nullptr, nullptr, nullptr};
+    for (unsigned int d = 0; d != this->_dim; ++d)
+      comps[d] = &dphi[d];
+    if (this->_dim)
+      FEInterface::all_shape_derivs(this->_dim, fe_type, this->_elem, qp, comps);
+
+    for (unsigned int i = 0; i != n_shapes; ++i)
+      for (auto p : index_range(qp))
+        {
+          LIBMESH_ASSERT_FP_EQUAL
+            (FEInterface::shape(fe_type, this->_elem, i, qp[p]),
+             phi[i][p], this->_value_tol);
+          for (unsigned int d = 0; d != this->_dim; ++d)
+            LIBMESH_ASSERT_FP_EQUAL
+              (FEInterface::shape_deriv(fe_type, this->_elem, i, d, qp[p]),
+               dphi[d][i][p], this->_grad_tol);
+        }
+  }
+
+  void testSharedReferenceValues()
+  {
+    LOG_UNIT_TEST;
+
+    // Handle the "more processors than elements" case
+    if (!this->_elem)
+      return;
+
+    // Two FE objects on the same rule, so the second may pick up
+    // cached reference values from the first
+    FEType fe_type = this->_sys->variable_type(0);
+    std::unique_ptr<FEBase> fe1 (FEBase::build(this->_dim, fe_type));
+    std::unique_ptr<FEBase> fe2 (FEBase::build(this->_dim, fe_type));
+    fe1->attach_quadrature_rule (this->_qrule.get());
+    fe2->attach_quadrature_rule (this->_qrule.get());
+    const std::vector<std::vector<Real>> & phi1 = fe1->get_phi();
+    const std::vector<std::vector<Real>> & phi2 = fe2->get_phi();
+    const std::vector<std::vector<RealGradient>> & dphi1 = fe1->get_dphi();
+    const std::vector<std::vector<RealGradient>> & dphi2 = fe2->get_dphi();
+
+    fe1->reinit(this->_elem);
+
+    // Go through custom points and back, which must not leave stale
+    // values behind
+    const std::vector<Point> custom_pts {this->_qrule->qp(0)*0.5};
+    fe2->reinit(this->_elem, &custom_pts);
+    fe2->reinit(this->_elem);
+
+    CPPUNIT_ASSERT_EQUAL(phi1.size(), phi2.size());
+    for (auto i : index_range(phi1))
+      {
+        CPPUNIT_ASSERT_EQUAL(phi1[i].size(), phi2[i].size());
+        for (auto qp : index_range(phi1[i]))
+          {
+            LIBMESH_ASSERT_FP_EQUAL(phi1[i][qp], phi2[i][qp], this->_value_tol);
+            for (unsigned int d = 0; d != LIBMESH_DIM; ++d)
+              LIBMESH_ASSERT_FP_EQUAL(dphi1[i][qp](d), dphi2[i][qp](d),
+                                      this->_grad_tol);
+          }
+      }
+  }
+
+  void testTensorProductKernel()
+  {
+    LOG_UNIT_TEST;
+
+    // Handle the "more processors than elements" case
+    if (!this->_elem)
+      return;
+
+    std::unique_ptr<TensorProductKernel> kernel =
+      this->_fe->build_tensor_product_kernel(this->_elem->type());
+
+    // Most families and element types have no tensor structure
+    if (!kernel)
+      return;
+
+    this->_fe->reinit(this->_elem);
+    kernel->reinit(*this->_elem);
+
+    const std::vector<std::vector<Real>> & phi = this->_fe->get_phi();
+    const std::vector<std::vector<RealGradient>> & dphi = this->_fe->get_dphi();
+    const unsigned int n_dofs = phi.size();
+    const unsigned int n_qp = this->_qrule->n_points();
+    CPPUNIT_ASSERT_EQUAL(n_dofs, kernel->n_dofs());
+    CPPUNIT_ASSERT_EQUAL(n_qp, kernel->n_qp());
+
+    std::vector<Number> coefs(n_dofs);
+    for (auto i : make_range(n_dofs))
+      coefs[i] = this->_sys->current_solution(this->_dof_indices[i]);
+
+    std::vector<Number> values;
+    std::vector<Gradient> grads;
+    kernel->interpolate(coefs, values);
+    kernel->interpolate_gradients(coefs, *this->_fe, grads);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(n_qp), values.size());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(n_qp), grads.size());
+
+    for (auto qp : make_range(n_qp))
+      {
+        Number u = 0;
+        Gradient grad_u;
+        for (auto i : make_range(n_dofs))
+          {
+            u += phi[i][qp] * coefs[i];
+            grad_u.add_scaled(dphi[i][qp], coefs[i]);
+          }
+
+        LIBMESH_ASSERT_FP_EQUAL(libmesh_real(u), libmesh_real(values[qp]), this->_value_tol);
+        for (unsigned int d = 0; d != LIBMESH_DIM; ++d)
+          LIBMESH_ASSERT_FP_EQUAL(libmesh_real(grad_u(d)),
+                                  libmesh_real(grads[qp](d)), this->_grad_tol);
+      }
+
+    // Integrate against some arbitrary data at the quadrature points
+    std::vector<Number> qp_values(n_qp);
+    std::vector<Gradient> qp_grads(n_qp);
+    for (auto qp : make_range(n_qp))
+      {
+        qp_values[qp] = Real(qp+1) / n_qp;
+        for (unsigned int d = 0; d != LIBMESH_DIM; ++d)
+          qp_grads[qp](d) = Real(d+1) - Real(qp) / n_qp;
+      }
+
+    std::vector<Number> residual(n_dofs, 0), grad_residual(n_dofs, 0);
+    kernel->integrate(qp_values, residual);
+    kernel->integrate_gradients(qp_grads, *this->_fe, grad_residual);
+
+    for (auto i : make_range(n_dofs))
+      {
+        Number r = 0, grad_r = 0;
+        for (auto qp : make_range(n_qp))
+          {
+            r += phi[i][qp] * qp_values[qp];
+            grad_r += dphi[i][qp] * qp_grads[qp];
+          }
+
+        LIBMESH_ASSERT_FP_EQUAL(libmesh_real(r), libmesh_real(residual[i]), this->_value_tol);
+        LIBMESH_ASSERT_FP_EQUAL(libmesh_real(grad_r),
+                                libmesh_real(grad_residual[i]), this->_grad_tol);
+      }
+  }
+
 };
 
 
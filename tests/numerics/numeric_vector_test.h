@@ -21,7 +21,9 @@
   CPPUNIT_TEST( testNorms );                    \
   CPPUNIT_TEST( testNormsBase );                \
   CPPUNIT_TEST( testOperations );               \
-  CPPUNIT_TEST( testOperationsBase );
+  CPPUNIT_TEST( testOperationsBase );           \
+  CPPUNIT_TEST( testFusedOperations );          \
+  CPPUNIT_TEST( testFusedOperationsBase );
 
 
 template <class DerivedClass>
@@ -143,6 +145,66 @@ public:
                             libMesh::TOLERANCE*libMesh::TOLERANCE);
   }
 
+  template <class Base, class Derived>
+  void FusedOperations()
+  {
+    auto x_ptr = std::make_unique<Derived>(*my_comm, global_size, local_size);
+    auto y_ptr = std::make_unique<Derived>(*my_comm, global_size, local_size);
+    auto z_ptr = std::make_unique<Derived>(*my_comm, global_size, local_size);
+    Base & x = *x_ptr;
+    Base & y = *y_ptr;
+    Base & z = *z_ptr;
+
+    const libMesh::dof_id_type
+      first = x.first_local_index(),
+      last  = x.last_local_index();
+
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      {
+        x.set (n, static_cast<libMesh::Number>(n+1));
+        y.set (n, 2);
+      }
+    x.close();
+    y.close();
+    z.close();
+
+    z.waxpy(3, x, y);
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(z(n)),
+                              libMesh::Real(3*n+5),
+                              libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+    z.axpbypcz(1, x, 2, y, 0.5);
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(z(n)),
+                              libMesh::Real(2.5*n+7.5),
+                              libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+    z.maxpy({1, -1}, {&x, &y});
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(z(n)),
+                              libMesh::Real(3.5*n+6.5),
+                              libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+    const libMesh::Real N = global_size;
+
+    std::vector<libMesh::Number> dots;
+    x.mdot({&x, &y}, dots);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), dots.size());
+    LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(dots[0]),
+                            N*(N+1)*(2*N+1)/6,
+                            libMesh::TOLERANCE*libMesh::TOLERANCE);
+    LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(dots[1]),
+                            N*(N+1),
+                            libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+    const auto [dot, norm_sq] = x.dot_and_norm_sq(y);
+    LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(dot), N*(N+1),
+                            libMesh::TOLERANCE*libMesh::TOLERANCE);
+    LIBMESH_ASSERT_FP_EQUAL(norm_sq, 4*N,
+                            libMesh::TOLERANCE*libMesh::TOLERANCE);
+  }
+
   template <class Base, class Derived>
   void Norms()
   {
@@ -363,6 +425,20 @@ public:
 
     Operations<libMesh::NumericVector<libMesh::Number>,DerivedClass>();
   }
+
+  void testFusedOperations()
+  {
+    LOG_UNIT_TEST;
+
+    FusedOperations<DerivedClass,DerivedClass >();
+  }
+
+  void testFusedOperationsBase()
+  {
+    LOG_UNIT_TEST;
+
+    FusedOperations<libMesh::NumericVector<libMesh::Number>,DerivedClass>();
+  }
 };
 
 #endif